@@ -46,6 +46,14 @@ void compute::execute_async(const std::vector<cluster_node> &nodes, std::string_
     m_impl->execute_on_one_node(get_random_element(nodes), job_class_name, args, std::move(callback));
 }
 
+void compute::execute_typed_async(const std::vector<cluster_node> &nodes, std::string_view job_class_name,
+    const detail::typed_arguments &args, ignite_callback<std::optional<primitive>> callback) {
+    detail::arg_check::container_non_empty(nodes, "Nodes container");
+    detail::arg_check::container_non_empty(job_class_name, "Job class name");
+
+    m_impl->execute_on_one_node(get_random_element(nodes), job_class_name, args, std::move(callback));
+}
+
 void compute::broadcast_async(const std::set<cluster_node> &nodes, std::string_view job_class_name,
     const std::vector<primitive> &args,
     ignite_callback<std::map<cluster_node, ignite_result<std::optional<primitive>>>> callback) {
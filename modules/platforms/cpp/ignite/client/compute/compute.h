@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "ignite/client/detail/typed_arguments.h"
 #include "ignite/client/network/cluster_node.h"
 #include "ignite/client/primitive.h"
 #include "ignite/client/table/ignite_tuple.h"
@@ -27,6 +28,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -72,6 +74,43 @@ public:
         });
     }
 
+    /**
+     * Executes a compute job represented by the given class on one of the specified nodes asynchronously.
+     *
+     * Arguments are encoded straight from their C++ types, without conversion to @c primitive.
+     *
+     * @param nodes Nodes to use for the job execution.
+     * @param job_class_name Java class name of the job to execute.
+     * @param args Job arguments, e.g. @c std::forward_as_tuple(42, "abc").
+     * @param callback A callback called on operation completion with job execution result.
+     */
+    template<typename... Args, typename = std::enable_if_t<detail::are_arguments_v<Args...>>>
+    void execute_async(const std::vector<cluster_node> &nodes, std::string_view job_class_name,
+        const std::tuple<Args...> &args, ignite_callback<std::optional<primitive>> callback) {
+        execute_typed_async(nodes, job_class_name, detail::make_typed_arguments(args), std::move(callback));
+    }
+
+    /**
+     * Executes a compute job represented by the given class on one of the specified nodes.
+     *
+     * Arguments are encoded straight from their C++ types, without conversion to @c primitive.
+     *
+     * @param nodes Nodes to use for the job execution.
+     * @param job_class_name Java class name of the job to execute.
+     * @param args Job arguments.
+     * @return Job execution result.
+     */
+    template<typename... Args, typename = std::enable_if_t<detail::are_arguments_v<Args...>>>
+    std::optional<primitive> execute(
+        const std::vector<cluster_node> &nodes, std::string_view job_class_name, const Args &...args) {
+        auto values = std::forward_as_tuple(args...);
+        auto typed = detail::make_typed_arguments(values);
+
+        return sync<std::optional<primitive>>([this, &nodes, job_class_name, &typed](auto callback) {
+            execute_typed_async(nodes, job_class_name, typed, std::move(callback));
+        });
+    }
+
     /**
      * Executes a compute job represented by the given class on all of the specified nodes asynchronously.
      *
@@ -129,6 +168,17 @@ public:
     }
 
 private:
+    /**
+     * Executes a compute job with typed arguments on one of the specified nodes asynchronously.
+     *
+     * @param nodes Nodes to use for the job execution.
+     * @param job_class_name Java class name of the job to execute.
+     * @param args Typed job arguments. Only used before the call returns.
+     * @param callback A callback called on operation completion with job execution result.
+     */
+    IGNITE_API void execute_typed_async(const std::vector<cluster_node> &nodes, std::string_view job_class_name,
+        const detail::typed_arguments &args, ignite_callback<std::optional<primitive>> callback);
+
     /**
      * Constructor
      *
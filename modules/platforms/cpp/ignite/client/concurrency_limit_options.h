@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Concurrency limit options.
+ *
+ * With the concurrency limit, every connection caps the number of key-value requests it has sent and not received a
+ * response for yet. The limit adapts to the observed round-trip time: it grows by one per round trip while the
+ * round-trip time stays close to the lowest one seen, and is cut multiplicatively once the round-trip time grows,
+ * which means that the server has started queueing the work. Requests beyond the limit are queued on the client.
+ *
+ * SQL and compute requests may take arbitrary time on the server, so they are not counted against the limit. They
+ * only wait behind the queued requests, so that the requests of a connection are sent in order.
+ */
+class concurrency_limit_options {
+public:
+    /** Default initial limit. */
+    static constexpr std::int32_t DEFAULT_INITIAL_LIMIT{20};
+
+    /** Default minimum limit. */
+    static constexpr std::int32_t DEFAULT_MIN_LIMIT{1};
+
+    /** Default maximum limit. */
+    static constexpr std::int32_t DEFAULT_MAX_LIMIT{1000};
+
+    /** Default round-trip time tolerance. */
+    static constexpr double DEFAULT_RTT_TOLERANCE{2.0};
+
+    /** Default maximum number of queued requests. */
+    static constexpr std::size_t DEFAULT_MAX_QUEUE_SIZE{10000};
+
+    // Default
+    concurrency_limit_options() = default;
+
+    /**
+     * Gets a value indicating whether the concurrency limit is enabled.
+     *
+     * @return @c true if the concurrency limit is enabled.
+     */
+    [[nodiscard]] bool enabled() const { return m_enabled; }
+
+    /**
+     * Sets a value indicating whether the concurrency limit is enabled. Disabled by default.
+     *
+     * @param val @c true to enable the concurrency limit.
+     */
+    void enabled(bool val) { m_enabled = val; }
+
+    /**
+     * Gets the initial limit.
+     *
+     * @return Initial limit.
+     */
+    [[nodiscard]] std::int32_t initial_limit() const { return m_initial_limit; }
+
+    /**
+     * Sets the initial limit of a new connection.
+     *
+     * @param val Initial limit.
+     */
+    void initial_limit(std::int32_t val) { m_initial_limit = val; }
+
+    /**
+     * Gets the minimum limit.
+     *
+     * @return Minimum limit.
+     */
+    [[nodiscard]] std::int32_t min_limit() const { return m_min_limit; }
+
+    /**
+     * Sets the minimum limit.
+     *
+     * @param val Minimum limit.
+     */
+    void min_limit(std::int32_t val) { m_min_limit = val; }
+
+    /**
+     * Gets the maximum limit.
+     *
+     * @return Maximum limit.
+     */
+    [[nodiscard]] std::int32_t max_limit() const { return m_max_limit; }
+
+    /**
+     * Sets the maximum limit.
+     *
+     * @param val Maximum limit.
+     */
+    void max_limit(std::int32_t val) { m_max_limit = val; }
+
+    /**
+     * Gets the round-trip time tolerance.
+     *
+     * @return Round-trip time tolerance.
+     */
+    [[nodiscard]] double rtt_tolerance() const { return m_rtt_tolerance; }
+
+    /**
+     * Sets the round-trip time tolerance. The limit is decreased when the round-trip time of a request exceeds the
+     * lowest observed one by this factor. Must be greater than one.
+     *
+     * @param val Round-trip time tolerance.
+     */
+    void rtt_tolerance(double val) { m_rtt_tolerance = val; }
+
+    /**
+     * Gets the maximum number of queued requests.
+     *
+     * @return Maximum number of queued requests.
+     */
+    [[nodiscard]] std::size_t max_queue_size() const { return m_max_queue_size; }
+
+    /**
+     * Sets the maximum number of requests which are queued on a connection. Key-value requests beyond this number
+     * fail right away: the operation throws an error instead of calling its callback. Zero value means that requests
+     * beyond the limit are never queued.
+     *
+     * @param val Maximum number of queued requests.
+     */
+    void max_queue_size(std::size_t val) { m_max_queue_size = val; }
+
+private:
+    /** Enabled flag. */
+    bool m_enabled{false};
+
+    /** Initial limit. */
+    std::int32_t m_initial_limit{DEFAULT_INITIAL_LIMIT};
+
+    /** Minimum limit. */
+    std::int32_t m_min_limit{DEFAULT_MIN_LIMIT};
+
+    /** Maximum limit. */
+    std::int32_t m_max_limit{DEFAULT_MAX_LIMIT};
+
+    /** Round-trip time tolerance. */
+    double m_rtt_tolerance{DEFAULT_RTT_TOLERANCE};
+
+    /** Maximum number of queued requests. */
+    std::size_t m_max_queue_size{DEFAULT_MAX_QUEUE_SIZE};
+};
+
+} // namespace ignite
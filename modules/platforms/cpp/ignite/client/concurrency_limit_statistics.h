@@ -0,0 +1,46 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ignite {
+
+/**
+ * Concurrency limit statistics of a connection.
+ */
+struct concurrency_limit_statistics {
+    /** Name of the node the connection is established with. */
+    std::string node_name;
+
+    /** Current limit of requests in flight. */
+    std::int32_t limit{0};
+
+    /** Number of key-value requests in flight, which are counted against the limit. */
+    std::int32_t in_flight{0};
+
+    /** Number of queued requests. */
+    std::size_t queued{0};
+
+    /** Number of requests which failed because the queue was full. */
+    std::int64_t rejected{0};
+};
+
+} // namespace ignite
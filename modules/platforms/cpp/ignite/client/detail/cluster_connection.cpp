@@ -33,6 +33,11 @@ cluster_connection::cluster_connection(ignite_client_configuration configuration
     , m_pool()
     , m_logger(std::make_shared<logger_wrapper>(m_configuration.get_logger()))
     , m_generator(std::random_device()()) {
+    if (m_configuration.get_concurrency_limit().enabled())
+        concurrency_limiter::check_options(m_configuration.get_concurrency_limit());
+
+    if (m_configuration.get_hedged_reads().enabled())
+        m_hedged_reads = hedged_read_policy::create(m_configuration.get_hedged_reads());
 }
 
 void cluster_connection::start_async(std::function<void(ignite_result<void>)> callback) {
@@ -202,4 +207,63 @@ std::shared_ptr<node_connection> cluster_connection::get_random_channel() {
     return std::next(m_connections.begin(), idx)->second;
 }
 
+std::vector<concurrency_limit_statistics> cluster_connection::get_concurrency_limit_statistics() {
+    std::vector<std::shared_ptr<node_connection>> connections;
+    {
+        [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+
+        connections.reserve(m_connections.size());
+        for (auto &connection : m_connections)
+            connections.push_back(connection.second);
+    }
+
+    std::vector<concurrency_limit_statistics> res;
+    for (auto &connection : connections) {
+        if (!connection->is_handshake_complete())
+            continue;
+
+        auto stats = connection->get_concurrency_limit_statistics();
+        if (stats)
+            res.push_back(std::move(*stats));
+    }
+
+    return res;
+}
+
+std::shared_ptr<node_connection> cluster_connection::get_random_channel_except(const node_connection &excluded) {
+    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+
+    auto excluded_it = m_connections.find(excluded.id());
+    auto others = m_connections.size() - (excluded_it == m_connections.end() ? 0 : 1);
+    if (others == 0)
+        return {};
+
+    std::uniform_int_distribution<size_t> distrib(0, others - 1);
+    auto idx = distrib(m_generator);
+    for (auto it = m_connections.begin(); it != m_connections.end(); ++it) {
+        if (it == excluded_it)
+            continue;
+
+        if (idx == 0)
+            return it->second;
+
+        --idx;
+    }
+
+    return {};
+}
+
+void cluster_connection::perform_hedged_request(client_operation op,
+    const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler) {
+    while (true) {
+        auto channel = get_random_channel();
+        if (!channel)
+            throw ignite_error("No nodes connected");
+
+        auto secondary = get_random_channel_except(*channel);
+        if (m_hedged_reads->perform_request(op, wr, handler, channel, secondary))
+            return;
+    }
+}
+
 } // namespace ignite::detail
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "ignite/client/detail/client_operation.h"
+#include "ignite/client/detail/hedged_read_policy.h"
 #include "ignite/client/detail/node_connection.h"
 #include "ignite/client/detail/protocol_context.h"
 #include "ignite/client/detail/response_handler.h"
@@ -36,6 +37,7 @@
 #include <mutex>
 #include <random>
 #include <unordered_map>
+#include <vector>
 
 namespace ignite::protocol {
 
@@ -103,17 +105,18 @@ public:
     void perform_request_handler(client_operation op, transaction_impl *tx,
         const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler) {
         if (tx) {
-            auto channel = tx->get_connection();
-            if (!channel)
-                throw ignite_error("Transaction was not started properly");
-
-            auto res = channel->perform_request(op, wr, handler);
+            auto res = tx->perform_request(op, wr, handler);
             if (!res)
                 throw ignite_error("Connection associated with the transaction is closed");
 
             return;
         }
 
+        if (m_hedged_reads && hedged_read_policy::is_hedgeable(op)) {
+            perform_hedged_request(op, wr, handler);
+            return;
+        }
+
         while (true) {
             auto channel = get_random_channel();
             if (!channel)
@@ -260,7 +263,6 @@ public:
             op, tx, wr, [](protocol::reader &) {}, std::move(callback));
     }
 
-private:
     /**
      * Get random node connection.
      *
@@ -268,6 +270,23 @@ private:
      */
     std::shared_ptr<node_connection> get_random_channel();
 
+    /**
+     * Get hedged read statistics.
+     *
+     * @return Hedged read statistics. All zeroes if hedged reads are disabled.
+     */
+    [[nodiscard]] hedged_read_statistics get_hedged_read_statistics() const {
+        return m_hedged_reads ? m_hedged_reads->get_statistics() : hedged_read_statistics{};
+    }
+
+    /**
+     * Get concurrency limit statistics of the active connections.
+     *
+     * @return Concurrency limit statistics. Empty if the concurrency limit is disabled.
+     */
+    [[nodiscard]] std::vector<concurrency_limit_statistics> get_concurrency_limit_statistics();
+
+private:
     /**
      * Constructor.
      *
@@ -275,6 +294,24 @@ private:
      */
     explicit cluster_connection(ignite_client_configuration configuration);
 
+    /**
+     * Perform a read which is hedged on a second node if the first one is slow to respond.
+     *
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param handler Request handler.
+     */
+    void perform_hedged_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        const std::shared_ptr<response_handler> &handler);
+
+    /**
+     * Get random node connection other than the specified one.
+     *
+     * @param excluded Connection to exclude.
+     * @return Random node connection or nullptr if there are no other active connections.
+     */
+    std::shared_ptr<node_connection> get_random_channel_except(const node_connection &excluded);
+
     /**
      * Callback that called on successful connection establishment.
      *
@@ -369,6 +406,9 @@ private:
 
     /** Generator. */
     std::mt19937 m_generator;
+
+    /** Hedged read policy. @c nullptr if hedged reads are disabled. */
+    std::shared_ptr<hedged_read_policy> m_hedged_reads;
 };
 
 } // namespace ignite::detail
@@ -36,18 +36,12 @@ void write_primitives_as_binary_tuple(protocol::writer &writer, const std::vecto
 
     binary_tuple_builder args_builder{args_num * 3};
 
-    args_builder.start();
-    for (const auto &arg : args) {
-        claim_primitive_with_type(args_builder, arg);
-    }
-
-    args_builder.layout();
+    args_builder.start_single_pass();
     for (const auto &arg : args) {
         append_primitive_with_type(args_builder, arg);
     }
 
-    auto args_data = args_builder.build();
-    writer.write_binary(args_data);
+    args_builder.build(writer.reserve_binary(args_builder.get_tuple_size()));
 }
 
 /**
@@ -65,13 +59,21 @@ std::optional<primitive> read_primitive_from_binary_tuple(protocol::reader &read
     return read_next_column(parser, typ, scale);
 }
 
-void compute_impl::execute_on_one_node(cluster_node node, std::string_view job_class_name,
-    const std::vector<primitive> &args, ignite_callback<std::optional<primitive>> callback) {
-
-    auto writer_func = [&node, job_class_name, args](protocol::writer &writer) {
+/**
+ * Execute a job on the specified node.
+ *
+ * @param conn Connection.
+ * @param node Node to use for the job execution.
+ * @param job_class_name Java class name of the job to execute.
+ * @param args_writer Function writing the job arguments.
+ * @param callback Callback.
+ */
+void execute_on_node(cluster_connection &conn, const cluster_node &node, std::string_view job_class_name,
+    const std::function<void(protocol::writer &)> &args_writer, ignite_callback<std::optional<primitive>> callback) {
+    auto writer_func = [&node, job_class_name, &args_writer](protocol::writer &writer) {
         writer.write(node.get_name());
         writer.write(job_class_name);
-        write_primitives_as_binary_tuple(writer, args);
+        args_writer(writer);
     };
 
     auto reader_func = [](protocol::reader &reader) -> std::optional<primitive> {
@@ -81,27 +83,71 @@ void compute_impl::execute_on_one_node(cluster_node node, std::string_view job_c
         return read_primitive_from_binary_tuple(reader);
     };
 
-    m_connection->perform_request<std::optional<primitive>>(
+    conn.perform_request<std::optional<primitive>>(
         client_operation::COMPUTE_EXECUTE, writer_func, std::move(reader_func), std::move(callback));
 }
 
-void compute_impl::execute_colocated_async(std::string_view table_name, const ignite_tuple &key, std::string_view job,
+void compute_impl::execute_on_one_node(cluster_node node, std::string_view job_class_name,
     const std::vector<primitive> &args, ignite_callback<std::optional<primitive>> callback) {
-    m_tables->get_table_async(table_name,
-        [table_name = std::string(table_name), callback = std::move(callback), key, job = std::string(job), args,
-            conn = m_connection](auto &&res) mutable {
+    execute_on_node(
+        *m_connection, node, job_class_name,
+        [&args](protocol::writer &writer) { write_primitives_as_binary_tuple(writer, args); }, std::move(callback));
+}
+
+void compute_impl::execute_on_one_node(cluster_node node, std::string_view job_class_name,
+    const typed_arguments &args, ignite_callback<std::optional<primitive>> callback) {
+    execute_on_node(
+        *m_connection, node, job_class_name,
+        [&args](protocol::writer &writer) {
+            writer.write(args.count);
+            write_typed_arguments(writer, args);
+        },
+        std::move(callback));
+}
+
+/**
+ * Execute a job colocated with the key, retrying once with a fresh table handle if the cached one turns out to
+ * refer to a table which was dropped in the meantime.
+ *
+ * @param tables Tables.
+ * @param conn Connection.
+ * @param table_name Table name.
+ * @param key Key.
+ * @param job Job class name.
+ * @param args Job arguments.
+ * @param retry Whether to retry the execution on a table-not-found error.
+ * @param callback Callback.
+ */
+void execute_colocated(std::shared_ptr<tables_impl> tables, std::shared_ptr<cluster_connection> conn,
+    std::string table_name, ignite_tuple key, std::string job, std::vector<primitive> args, bool retry,
+    ignite_callback<std::optional<primitive>> callback) {
+    auto tables0 = tables;
+    auto table_name0 = table_name;
+    tables0->get_table_impl_async(table_name0,
+        [tables = std::move(tables), conn = std::move(conn), table_name = std::move(table_name), key = std::move(key),
+            job = std::move(job), args = std::move(args), retry, callback = std::move(callback)](auto &&res) mutable {
             if (res.has_error()) {
                 callback({std::move(res.error())});
                 return;
             }
-            auto &table_opt = res.value();
-            if (!table_opt) {
+            auto table = std::move(res).value();
+            if (!table) {
                 callback({ignite_error("Table does not exist: '" + table_name + "'")});
                 return;
             }
 
-            auto table = table_impl::from_facade(*table_opt);
-            table->template with_latest_schema_async<std::optional<primitive>>(std::move(callback),
+            ignite_callback<std::optional<primitive>> handler = [tables, conn, table_name, key, job, args, retry,
+                                                                    callback = std::move(callback)](
+                                                                    ignite_result<std::optional<primitive>> &&res) {
+                if (retry && res.has_error() && table_impl::is_table_not_found(res.error())) {
+                    execute_colocated(tables, conn, table_name, key, job, args, false, callback);
+                    return;
+                }
+
+                callback(std::move(res));
+            };
+
+            table->template with_latest_schema_async<std::optional<primitive>>(std::move(handler),
                 [table, key = std::move(key), job = std::move(job), args = std::move(args),
                     conn] // NOLINT(performance-move-const-arg)
                 (const schema &sch, auto callback) mutable {
@@ -128,4 +174,10 @@ void compute_impl::execute_colocated_async(std::string_view table_name, const ig
         });
 }
 
+void compute_impl::execute_colocated_async(std::string_view table_name, const ignite_tuple &key, std::string_view job,
+    const std::vector<primitive> &args, ignite_callback<std::optional<primitive>> callback) {
+    execute_colocated(m_tables, m_connection, std::string(table_name), key, std::string(job), args, true,
+        std::move(callback));
+}
+
 } // namespace ignite::detail
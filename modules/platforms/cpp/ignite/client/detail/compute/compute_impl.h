@@ -19,6 +19,7 @@
 
 #include "ignite/client/detail/cluster_connection.h"
 #include "ignite/client/detail/table/tables_impl.h"
+#include "ignite/client/detail/typed_arguments.h"
 #include "ignite/client/network/cluster_node.h"
 #include "ignite/client/primitive.h"
 #include "ignite/client/table/ignite_tuple.h"
@@ -56,6 +57,17 @@ public:
     void execute_on_one_node(cluster_node node, std::string_view job_class_name, const std::vector<primitive> &args,
         ignite_callback<std::optional<primitive>> callback);
 
+    /**
+     * Executes a compute job represented by the given class on the specified node asynchronously.
+     *
+     * @param node Node to use for the job execution.
+     * @param job_class_name Java class name of the job to execute.
+     * @param args Typed job arguments.
+     * @param callback A callback called on operation completion with job execution result.
+     */
+    void execute_on_one_node(cluster_node node, std::string_view job_class_name, const typed_arguments &args,
+        ignite_callback<std::optional<primitive>> callback);
+
     /**
      * Asynchronously executes a job represented by the given class on one node where the given key is located.
      *
@@ -0,0 +1,89 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/concurrency_limiter.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <algorithm>
+#include <string>
+
+namespace ignite::detail {
+
+void concurrency_limiter::check_options(const concurrency_limit_options &options) {
+    if (options.min_limit() <= 0)
+        throw ignite_error("Minimum concurrency limit is not positive: " + std::to_string(options.min_limit()));
+
+    if (options.max_limit() < options.min_limit())
+        throw ignite_error("Maximum concurrency limit is less than the minimum one: "
+            + std::to_string(options.max_limit()) + " < " + std::to_string(options.min_limit()));
+
+    if (options.initial_limit() < options.min_limit() || options.initial_limit() > options.max_limit())
+        throw ignite_error(
+            "Initial concurrency limit is out of the limits range: " + std::to_string(options.initial_limit()));
+
+    if (options.rtt_tolerance() <= 1.0)
+        throw ignite_error(
+            "Round-trip time tolerance is not greater than one: " + std::to_string(options.rtt_tolerance()));
+}
+
+bool concurrency_limiter::try_acquire() {
+    if (m_in_flight >= get_limit())
+        return false;
+
+    ++m_in_flight;
+    return true;
+}
+
+void concurrency_limiter::release(std::optional<std::chrono::microseconds> rtt) {
+    if (rtt)
+        on_sample(*rtt);
+
+    --m_in_flight;
+}
+
+void concurrency_limiter::on_sample(std::chrono::microseconds rtt) {
+    m_min_rtt = std::min(m_min_rtt, rtt);
+    m_window_min_rtt = std::min(m_window_min_rtt, rtt);
+    if (++m_window_samples >= RTT_WINDOW) {
+        // Let the baseline go up if the network path has changed.
+        m_min_rtt = m_window_min_rtt;
+        m_window_min_rtt = std::chrono::microseconds::max();
+        m_window_samples = 0;
+    }
+
+    m_smoothed_rtt = m_smoothed_rtt.count() == 0 ? rtt : (m_smoothed_rtt * 7 + rtt) / 8;
+
+    if (double(rtt.count()) > double(m_min_rtt.count()) * m_options.rtt_tolerance()) {
+        // Requests sent before the previous decrease are still affected by the old limit, so the limit is cut at
+        // most once per round trip.
+        auto now = std::chrono::steady_clock::now();
+        if (now - m_last_decrease < m_smoothed_rtt)
+            return;
+
+        m_limit = std::max(double(m_options.min_limit()), m_limit * BACKOFF_RATIO);
+        m_last_decrease = now;
+
+        return;
+    }
+
+    // Only grow the limit when it is actually in use.
+    if (m_in_flight * 2 >= get_limit())
+        m_limit = std::min(double(m_options.max_limit()), m_limit + 1.0 / m_limit);
+}
+
+} // namespace ignite::detail
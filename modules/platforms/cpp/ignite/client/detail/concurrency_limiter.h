@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/concurrency_limit_options.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ignite::detail {
+
+/**
+ * Adaptive limit of requests in flight on a connection.
+ *
+ * Uses additive increase and multiplicative decrease driven by the round-trip time: the limit grows by one per round
+ * trip while the round-trip time stays within the tolerance of the lowest one observed recently, and is cut once it
+ * does not. Not thread-safe, the connection calls it under its own lock.
+ */
+class concurrency_limiter {
+public:
+    // Deleted
+    concurrency_limiter() = delete;
+    concurrency_limiter(concurrency_limiter &&) = delete;
+    concurrency_limiter(const concurrency_limiter &) = delete;
+    concurrency_limiter &operator=(concurrency_limiter &&) = delete;
+    concurrency_limiter &operator=(const concurrency_limiter &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param options Options.
+     */
+    explicit concurrency_limiter(const concurrency_limit_options &options)
+        : m_options(options)
+        , m_limit(options.initial_limit()) {}
+
+    /**
+     * Check options.
+     *
+     * @throw ignite_error if the options are not valid.
+     * @param options Options.
+     */
+    static void check_options(const concurrency_limit_options &options);
+
+    /**
+     * Take a slot for a request.
+     *
+     * @return @c true if the limit allows one more request in flight.
+     */
+    bool try_acquire();
+
+    /**
+     * Release the slot of a completed request.
+     *
+     * @param rtt Round-trip time of the request or @c std::nullopt if no response was received.
+     */
+    void release(std::optional<std::chrono::microseconds> rtt);
+
+    /**
+     * Get the current limit.
+     *
+     * @return Current limit.
+     */
+    [[nodiscard]] std::int32_t get_limit() const { return std::int32_t(m_limit); }
+
+    /**
+     * Get the number of requests in flight.
+     *
+     * @return Number of requests in flight.
+     */
+    [[nodiscard]] std::int32_t get_in_flight() const { return m_in_flight; }
+
+private:
+    /** Factor the limit is multiplied by when the round-trip time grows. */
+    static constexpr double BACKOFF_RATIO{0.9};
+
+    /** Number of samples after which the lowest round-trip time is reset to the lowest one of these samples. */
+    static constexpr std::size_t RTT_WINDOW{1000};
+
+    /**
+     * Adjust the limit by the round-trip time of a request.
+     *
+     * @param rtt Round-trip time.
+     */
+    void on_sample(std::chrono::microseconds rtt);
+
+    /** Options. */
+    const concurrency_limit_options m_options;
+
+    /** Current limit. */
+    double m_limit;
+
+    /** Number of requests in flight. */
+    std::int32_t m_in_flight{0};
+
+    /** Lowest round-trip time. */
+    std::chrono::microseconds m_min_rtt{std::chrono::microseconds::max()};
+
+    /** Lowest round-trip time in the current window. */
+    std::chrono::microseconds m_window_min_rtt{std::chrono::microseconds::max()};
+
+    /** Number of samples in the current window. */
+    std::size_t m_window_samples{0};
+
+    /** Smoothed round-trip time. */
+    std::chrono::microseconds m_smoothed_rtt{0};
+
+    /** Time of the last decrease. */
+    std::chrono::steady_clock::time_point m_last_decrease{};
+};
+
+} // namespace ignite::detail
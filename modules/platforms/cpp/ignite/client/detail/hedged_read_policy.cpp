@@ -0,0 +1,351 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/hedged_read_policy.h"
+
+#include "ignite/common/config.h"
+#include "ignite/common/ignite_error.h"
+#include "ignite/common/ignite_result.h"
+
+#include <algorithm>
+
+namespace ignite::detail {
+
+namespace {
+
+/**
+ * State of a hedged read shared by both of its requests.
+ */
+struct hedged_read {
+    /**
+     * Constructor.
+     *
+     * @param op Operation code.
+     * @param handler Original response handler.
+     * @param policy Policy.
+     */
+    hedged_read(
+        client_operation op, std::shared_ptr<response_handler> handler, std::weak_ptr<hedged_read_policy> policy)
+        : op(op)
+        , handler(std::move(handler))
+        , policy(std::move(policy)) {}
+
+    /** Operation code. */
+    const client_operation op;
+
+    /** Original response handler. */
+    const std::shared_ptr<response_handler> handler;
+
+    /** Policy. */
+    const std::weak_ptr<hedged_read_policy> policy;
+
+    /** Time the primary request was sent. */
+    const std::chrono::steady_clock::time_point started{std::chrono::steady_clock::now()};
+
+    /** Number of requests which are sent and not answered yet. */
+    std::int32_t in_flight{1};
+
+    /** Completed flag. Set once the original handler is called. */
+    bool complete{false};
+
+    /** Mutex. */
+    std::mutex mutex;
+};
+
+/**
+ * Response handler of one of the requests of a hedged read.
+ */
+class hedged_response_handler final : public response_handler {
+public:
+    /**
+     * Constructor.
+     *
+     * @param read Hedged read.
+     * @param hedge @c true if this is the handler of the hedged request.
+     */
+    hedged_response_handler(std::shared_ptr<hedged_read> read, bool hedge)
+        : m_read(std::move(read))
+        , m_hedge(hedge) {}
+
+    /**
+     * Handle response.
+     *
+     * The first response completes the read, the late one is only used for the latency statistics.
+     *
+     * @param channel Channel.
+     * @param msg Message.
+     */
+    [[nodiscard]] ignite_result<void> handle(std::shared_ptr<node_connection> channel, bytes_view msg) final {
+        bool first;
+        {
+            std::lock_guard<std::mutex> lock(m_read->mutex);
+            --m_read->in_flight;
+            first = !m_read->complete;
+            m_read->complete = true;
+        }
+
+        if (auto policy = m_read->policy.lock()) {
+            if (!m_hedge) {
+                auto latency = std::chrono::steady_clock::now() - m_read->started;
+                policy->record_latency(m_read->op, std::chrono::duration_cast<std::chrono::microseconds>(latency));
+            } else if (first) {
+                policy->record_hedge_won();
+            }
+        }
+
+        if (!first)
+            return {};
+
+        return m_read->handler->handle(std::move(channel), msg);
+    }
+
+    /**
+     * Set error.
+     *
+     * The error is only passed to the original handler if the other request can not answer anymore.
+     *
+     * @param err Error to set.
+     */
+    [[nodiscard]] ignite_result<void> set_error(ignite_error err) final {
+        {
+            std::lock_guard<std::mutex> lock(m_read->mutex);
+            --m_read->in_flight;
+            if (m_read->complete || m_read->in_flight > 0)
+                return {};
+
+            m_read->complete = true;
+        }
+
+        return m_read->handler->set_error(std::move(err));
+    }
+
+private:
+    /** Hedged read. */
+    std::shared_ptr<hedged_read> m_read;
+
+    /** Hedged request flag. */
+    bool m_hedge;
+};
+
+} // namespace
+
+std::shared_ptr<hedged_read_policy> hedged_read_policy::create(const hedged_read_options &options) {
+    if (options.delay().count() < 0)
+        throw ignite_error("Hedging delay is negative: " + std::to_string(options.delay().count()));
+
+    if (options.percentile() <= 0.0 || options.percentile() >= 1.0)
+        throw ignite_error("Hedging percentile is not in the (0, 1) range: " + std::to_string(options.percentile()));
+
+    if (options.max_extra_load() <= 0.0 || options.max_extra_load() > 1.0)
+        throw ignite_error(
+            "Hedging max extra load is not in the (0, 1] range: " + std::to_string(options.max_extra_load()));
+
+    return std::shared_ptr<hedged_read_policy>(new hedged_read_policy(options));
+}
+
+hedged_read_policy::~hedged_read_policy() {
+    {
+        std::lock_guard<std::mutex> lock(m_timer->mutex);
+        m_timer->stopped = true;
+        m_timer->tasks.clear();
+    }
+    m_timer->cond.notify_all();
+
+    if (m_thread.joinable()) {
+        // The last reference can be released by a task running on the timer thread.
+        if (m_thread.get_id() == std::this_thread::get_id())
+            m_thread.detach();
+        else
+            m_thread.join();
+    }
+}
+
+std::optional<std::size_t> hedged_read_policy::op_index(client_operation op) {
+    switch (op) {
+        case client_operation::TUPLE_GET:
+            return 0;
+        case client_operation::TUPLE_GET_ALL:
+            return 1;
+        case client_operation::TUPLE_CONTAINS_KEY:
+            return 2;
+        default:
+            return std::nullopt;
+    }
+}
+
+bool hedged_read_policy::perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
+    const std::shared_ptr<response_handler> &handler, const std::shared_ptr<node_connection> &primary,
+    const std::shared_ptr<node_connection> &secondary) {
+    m_reads.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_budget_mutex);
+        m_budget = std::min(m_budget + m_options.max_extra_load(), MAX_BUDGET);
+    }
+
+    auto delay = secondary ? get_delay(op) : std::nullopt;
+    auto read = std::make_shared<hedged_read>(op, handler, weak_from_this());
+
+    // The writer function is only valid during this call, so the bytes of the request are kept for the hedge, which
+    // is only given its own request ID once it is actually sent.
+    auto [req_id, message] = primary->make_request(op, wr);
+    std::optional<std::vector<std::byte>> hedge;
+    if (delay)
+        hedge = message;
+
+    if (!primary->send_request(op, req_id, std::move(message), std::make_shared<hedged_response_handler>(read, false)))
+        return false;
+
+    if (!hedge)
+        return true;
+
+    schedule(*delay, [self = weak_from_this(), read, secondary, op, hedge = std::move(*hedge)]() mutable {
+        auto policy = self.lock();
+        if (!policy)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(read->mutex);
+            if (read->complete)
+                return;
+
+            if (!policy->try_acquire_budget()) {
+                policy->m_hedges_over_budget.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            ++read->in_flight;
+        }
+        policy->m_hedges_issued.fetch_add(1, std::memory_order_relaxed);
+
+        auto [hedge_id, hedge_message] = secondary->reframe_request(hedge);
+        auto hedge_handler = std::make_shared<hedged_response_handler>(read, true);
+        auto sent = result_of_operation<bool>(
+            [&] { return secondary->send_request(op, hedge_id, std::move(hedge_message), hedge_handler); });
+
+        if (sent.has_error() || !sent.value()) {
+            auto res = hedge_handler->set_error(
+                sent.has_error() ? std::move(sent).error() : ignite_error("Connection is closed"));
+            UNUSED_VALUE res;
+        }
+    });
+
+    return true;
+}
+
+void hedged_read_policy::record_latency(client_operation op, std::chrono::microseconds latency) {
+    auto idx = op_index(op);
+    if (!idx)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_latency_mutex);
+    auto &latency_samples = m_latency[*idx];
+    if (latency_samples.samples.size() < MAX_SAMPLES) {
+        latency_samples.samples.push_back(latency);
+    } else {
+        latency_samples.samples[latency_samples.pos] = latency;
+        latency_samples.pos = (latency_samples.pos + 1) % MAX_SAMPLES;
+    }
+
+    ++latency_samples.added;
+    if (latency_samples.samples.size() < MIN_SAMPLES || latency_samples.added < RECALCULATE_INTERVAL)
+        return;
+
+    latency_samples.added = 0;
+
+    auto sorted = latency_samples.samples;
+    auto nth = sorted.begin() + std::ptrdiff_t(m_options.percentile() * double(sorted.size() - 1));
+    std::nth_element(sorted.begin(), nth, sorted.end());
+    latency_samples.percentile = *nth;
+}
+
+hedged_read_statistics hedged_read_policy::get_statistics() const {
+    hedged_read_statistics res;
+    res.reads = m_reads.load(std::memory_order_relaxed);
+    res.hedges_issued = m_hedges_issued.load(std::memory_order_relaxed);
+    res.hedges_won = m_hedges_won.load(std::memory_order_relaxed);
+    res.hedges_over_budget = m_hedges_over_budget.load(std::memory_order_relaxed);
+
+    return res;
+}
+
+std::optional<std::chrono::microseconds> hedged_read_policy::get_delay(client_operation op) {
+    if (m_options.delay().count() > 0)
+        return m_options.delay();
+
+    auto idx = op_index(op);
+    if (!idx)
+        return std::nullopt;
+
+    std::lock_guard<std::mutex> lock(m_latency_mutex);
+    auto &latency_samples = m_latency[*idx];
+    if (latency_samples.percentile.count() == 0)
+        return std::nullopt;
+
+    return latency_samples.percentile;
+}
+
+bool hedged_read_policy::try_acquire_budget() {
+    std::lock_guard<std::mutex> lock(m_budget_mutex);
+    if (m_budget < 1.0)
+        return false;
+
+    m_budget -= 1.0;
+    return true;
+}
+
+void hedged_read_policy::schedule(std::chrono::microseconds delay, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_timer->mutex);
+        if (m_timer->stopped)
+            return;
+
+        m_timer->tasks.emplace(std::chrono::steady_clock::now() + delay, std::move(task));
+
+        if (!m_thread.joinable())
+            m_thread = std::thread(timer_routine, m_timer);
+    }
+    m_timer->cond.notify_one();
+}
+
+void hedged_read_policy::timer_routine(std::shared_ptr<timer_queue> queue) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    while (!queue->stopped) {
+        if (queue->tasks.empty()) {
+            queue->cond.wait(lock);
+            continue;
+        }
+
+        auto first = queue->tasks.begin();
+        if (first->first > std::chrono::steady_clock::now()) {
+            queue->cond.wait_until(lock, first->first);
+            continue;
+        }
+
+        auto task = std::move(first->second);
+        queue->tasks.erase(first);
+
+        lock.unlock();
+        try {
+            task();
+        } catch (...) {
+            // A failed hedged request must not stop the timer, the primary request is still in flight.
+        }
+        lock.lock();
+    }
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,246 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/client_operation.h"
+#include "ignite/client/detail/node_connection.h"
+#include "ignite/client/detail/response_handler.h"
+#include "ignite/client/hedged_read_options.h"
+#include "ignite/client/hedged_read_statistics.h"
+
+#include "ignite/protocol/writer.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Hedged read policy.
+ *
+ * Sends idempotent reads to one node and, if there is no response within the hedging delay, sends the same request
+ * to another node. The first response is passed to the original handler and the other one is discarded.
+ */
+class hedged_read_policy : public std::enable_shared_from_this<hedged_read_policy> {
+public:
+    // Deleted
+    hedged_read_policy() = delete;
+    hedged_read_policy(hedged_read_policy &&) = delete;
+    hedged_read_policy(const hedged_read_policy &) = delete;
+    hedged_read_policy &operator=(hedged_read_policy &&) = delete;
+    hedged_read_policy &operator=(const hedged_read_policy &) = delete;
+
+    /**
+     * Create a new policy.
+     *
+     * @param options Options. Must have hedging enabled.
+     * @return New instance.
+     */
+    static std::shared_ptr<hedged_read_policy> create(const hedged_read_options &options);
+
+    /**
+     * Destructor.
+     */
+    ~hedged_read_policy();
+
+    /**
+     * Check whether the operation can be hedged.
+     *
+     * @param op Operation code.
+     * @return @c true if the operation is an idempotent read.
+     */
+    [[nodiscard]] static bool is_hedgeable(client_operation op) { return op_index(op).has_value(); }
+
+    /**
+     * Perform request.
+     *
+     * @param op Operation code. Must be hedgeable.
+     * @param wr Request writer function.
+     * @param handler Response handler.
+     * @param primary Connection to send the request to.
+     * @param secondary Connection to send the hedged request to. Can be @c nullptr, in which case the request is
+     *  not hedged.
+     * @return @c true on success and @c false if the request could not be sent to the primary connection.
+     */
+    bool perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        const std::shared_ptr<response_handler> &handler, const std::shared_ptr<node_connection> &primary,
+        const std::shared_ptr<node_connection> &secondary);
+
+    /**
+     * Record the latency of a response from the primary connection.
+     *
+     * @param op Operation code.
+     * @param latency Latency.
+     */
+    void record_latency(client_operation op, std::chrono::microseconds latency);
+
+    /**
+     * Record a response which came from the hedged request first.
+     */
+    void record_hedge_won() { m_hedges_won.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * Get statistics.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] hedged_read_statistics get_statistics() const;
+
+private:
+    /** Number of hedgeable operations. */
+    static constexpr std::size_t OPERATIONS_NUM{3};
+
+    /** Number of latency samples kept for every operation. */
+    static constexpr std::size_t MAX_SAMPLES{256};
+
+    /** Minimal number of latency samples to derive the hedging delay from. */
+    static constexpr std::size_t MIN_SAMPLES{32};
+
+    /** Number of new samples after which the hedging delay is recalculated. */
+    static constexpr std::size_t RECALCULATE_INTERVAL{16};
+
+    /** Maximum number of hedges which can be accumulated in the budget while there is no need for hedging. */
+    static constexpr double MAX_BUDGET{10.0};
+
+    /**
+     * Latency samples of an operation.
+     */
+    struct latency_samples {
+        /** Samples ring. */
+        std::vector<std::chrono::microseconds> samples;
+
+        /** Next position in the ring. */
+        std::size_t pos{0};
+
+        /** Number of samples added since the last recalculation. */
+        std::size_t added{0};
+
+        /** Latency percentile calculated from the samples. */
+        std::chrono::microseconds percentile{0};
+    };
+
+    /**
+     * Delayed tasks which are shared with the timer thread.
+     */
+    struct timer_queue {
+        /** Tasks by time. */
+        std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> tasks;
+
+        /** Stopped flag. */
+        bool stopped{false};
+
+        /** Mutex. */
+        std::mutex mutex;
+
+        /** Condition variable. */
+        std::condition_variable cond;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param options Options.
+     */
+    explicit hedged_read_policy(const hedged_read_options &options)
+        : m_options(options) {}
+
+    /**
+     * Get the index of a hedgeable operation.
+     *
+     * @param op Operation code.
+     * @return Index or @c std::nullopt if the operation can not be hedged.
+     */
+    [[nodiscard]] static std::optional<std::size_t> op_index(client_operation op);
+
+    /**
+     * Get the hedging delay of an operation.
+     *
+     * @param op Operation code.
+     * @return Hedging delay or @c std::nullopt if there are not enough latency samples yet.
+     */
+    [[nodiscard]] std::optional<std::chrono::microseconds> get_delay(client_operation op);
+
+    /**
+     * Take one hedge from the budget.
+     *
+     * @return @c true if the budget allows one more hedged request.
+     */
+    bool try_acquire_budget();
+
+    /**
+     * Schedule a task.
+     *
+     * @param delay Delay.
+     * @param task Task.
+     */
+    void schedule(std::chrono::microseconds delay, std::function<void()> task);
+
+    /**
+     * Timer thread routine.
+     *
+     * The thread only holds the queue, so the policy can be released while a task is running.
+     *
+     * @param queue Queue.
+     */
+    static void timer_routine(std::shared_ptr<timer_queue> queue);
+
+    /** Options. */
+    const hedged_read_options m_options;
+
+    /** Latency samples by operation index. */
+    std::array<latency_samples, OPERATIONS_NUM> m_latency{};
+
+    /** Latency mutex. */
+    std::mutex m_latency_mutex;
+
+    /** Number of hedges which can be issued. */
+    double m_budget{0};
+
+    /** Budget mutex. */
+    std::mutex m_budget_mutex;
+
+    /** Delayed tasks. */
+    std::shared_ptr<timer_queue> m_timer{std::make_shared<timer_queue>()};
+
+    /** Timer thread. Started with the first hedged request. */
+    std::thread m_thread;
+
+    /** Number of reads. */
+    std::atomic_int64_t m_reads{0};
+
+    /** Number of hedges issued. */
+    std::atomic_int64_t m_hedges_issued{0};
+
+    /** Number of hedges won. */
+    std::atomic_int64_t m_hedges_won{0};
+
+    /** Number of hedges over budget. */
+    std::atomic_int64_t m_hedges_over_budget{0};
+};
+
+} // namespace ignite::detail
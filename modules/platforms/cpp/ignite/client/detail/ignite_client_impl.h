@@ -109,6 +109,24 @@ public:
      */
     [[nodiscard]] std::shared_ptr<transactions_impl> get_transactions_impl() const { return m_transactions; }
 
+    /**
+     * Get hedged read statistics.
+     *
+     * @return Hedged read statistics.
+     */
+    [[nodiscard]] hedged_read_statistics get_hedged_read_statistics() const {
+        return m_connection->get_hedged_read_statistics();
+    }
+
+    /**
+     * Get concurrency limit statistics.
+     *
+     * @return Concurrency limit statistics of the active connections.
+     */
+    [[nodiscard]] std::vector<concurrency_limit_statistics> get_concurrency_limit_statistics() const {
+        return m_connection->get_concurrency_limit_statistics();
+    }
+
     /**
      * Gets the cluster nodes asynchronously.
      * NOTE: Temporary API to enable Compute until we have proper Cluster API.
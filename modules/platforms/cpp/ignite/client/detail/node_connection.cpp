@@ -26,19 +26,28 @@ node_connection::node_connection(uint64_t id, std::shared_ptr<network::async_cli
     : m_id(id)
     , m_pool(std::move(pool))
     , m_logger(std::move(logger))
-    , m_configuration(cfg) { }
+    , m_configuration(cfg) {
+    if (m_configuration.get_concurrency_limit().enabled())
+        m_limiter = std::make_unique<concurrency_limiter>(m_configuration.get_concurrency_limit());
+}
 
 node_connection::~node_connection() {
-    for (auto &handler : m_request_handlers) {
+    auto set_error = [this](response_handler &handler) {
         auto handling_res = result_of_operation<void>([&]() {
-            auto res = handler.second->set_error(ignite_error("Connection closed before response was received"));
+            auto res = handler.set_error(ignite_error("Connection closed before response was received"));
             if (res.has_error())
                 m_logger->log_error(
                     "Uncaught user callback exception while handling operation error: " + res.error().what_str());
         });
         if (handling_res.has_error())
             m_logger->log_error("Uncaught user callback exception: " + handling_res.error().what_str());
-    }
+    };
+
+    for (auto &handler : m_request_handlers)
+        set_error(*handler.second);
+
+    for (auto &request : m_queue)
+        set_error(*request.handler);
 }
 
 bool node_connection::handshake() {
@@ -137,7 +146,7 @@ ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
 
     UNUSED_VALUE reader.read_int64(); // TODO: IGNITE-17606 Implement heartbeats
     UNUSED_VALUE reader.read_string_nullable(); // Cluster node ID. Needed for partition-aware compute.
-    UNUSED_VALUE reader.read_string_nullable(); // Cluster node name. Needed for partition-aware compute.
+    m_node_name = reader.read_string_nullable().value_or(""); // Cluster node name.
 
     auto cluster_id = reader.read_uuid();
     reader.skip(); // Features.
@@ -151,15 +160,163 @@ ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
     return {};
 }
 
-std::shared_ptr<response_handler> node_connection::get_and_remove_handler(int64_t req_id) {
+std::shared_ptr<response_handler> node_connection::get_and_remove_handler(int64_t req_id, bool responded) {
+    std::shared_ptr<response_handler> res;
+    std::vector<queued_request> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+
+        auto it = m_request_handlers.find(req_id);
+        if (it == m_request_handlers.end())
+            return {};
+
+        res = std::move(it->second);
+        m_request_handlers.erase(it);
+
+        if (!m_limiter)
+            return res;
+
+        auto now = std::chrono::steady_clock::now();
+        auto send_time = m_send_times.find(req_id);
+        if (send_time != m_send_times.end()) {
+            std::optional<std::chrono::microseconds> rtt;
+            if (responded)
+                rtt = std::chrono::duration_cast<std::chrono::microseconds>(now - send_time->second);
+
+            m_send_times.erase(send_time);
+            m_limiter->release(rtt);
+        }
+
+        while (!m_queue.empty()) {
+            auto &request = m_queue.front();
+            bool limited = is_limited(request.op);
+            if (limited && !m_limiter->try_acquire())
+                break;
+
+            m_request_handlers[request.req_id] = request.handler;
+            if (limited)
+                m_send_times[request.req_id] = now;
+
+            ready.push_back(std::move(request));
+            m_queue.pop_front();
+        }
+    }
+
+    send_queued(std::move(ready));
+
+    return res;
+}
+
+void node_connection::remove_unsent_handler(int64_t req_id) {
     std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
 
-    auto it = m_request_handlers.find(req_id);
-    if (it == m_request_handlers.end())
-        return {};
+    m_request_handlers.erase(req_id);
+
+    auto send_time = m_send_times.find(req_id);
+    if (send_time != m_send_times.end()) {
+        m_send_times.erase(send_time);
+        m_limiter->release(std::nullopt);
+    }
+}
+
+bool node_connection::is_limited(client_operation op) {
+    switch (op) {
+        case client_operation::TUPLE_UPSERT:
+        case client_operation::TUPLE_GET:
+        case client_operation::TUPLE_UPSERT_ALL:
+        case client_operation::TUPLE_GET_ALL:
+        case client_operation::TUPLE_GET_AND_UPSERT:
+        case client_operation::TUPLE_INSERT:
+        case client_operation::TUPLE_INSERT_ALL:
+        case client_operation::TUPLE_REPLACE:
+        case client_operation::TUPLE_REPLACE_EXACT:
+        case client_operation::TUPLE_GET_AND_REPLACE:
+        case client_operation::TUPLE_DELETE:
+        case client_operation::TUPLE_DELETE_ALL:
+        case client_operation::TUPLE_DELETE_EXACT:
+        case client_operation::TUPLE_DELETE_ALL_EXACT:
+        case client_operation::TUPLE_GET_AND_DELETE:
+        case client_operation::TUPLE_CONTAINS_KEY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool node_connection::send_request_limited(
+    client_operation op, int64_t req_id, std::vector<std::byte> message, std::shared_ptr<response_handler> handler) {
+    bool limited = is_limited(op);
+    {
+        std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+
+        if (!m_queue.empty() || (limited && !m_limiter->try_acquire())) {
+            // Requests which are not limited only wait behind the queued ones to keep the order, so they are never
+            // rejected.
+            if (!limited || m_queue.size() < m_configuration.get_concurrency_limit().max_queue_size()) {
+                m_queue.push_back({op, req_id, std::move(message), std::move(handler)});
+                return true;
+            }
+
+            ++m_rejected;
+
+            // Failing fast instead of trying another connection, as the other ones are likely to be overloaded as
+            // well. The error is thrown to the caller rather than passed to the handler, as the caller may hold locks
+            // which the handler takes.
+            throw ignite_error("Too many requests in flight to the node " + m_node_name
+                + ": limit=" + std::to_string(m_limiter->get_limit()));
+        }
+
+        m_request_handlers[req_id] = std::move(handler);
+        if (limited)
+            m_send_times[req_id] = std::chrono::steady_clock::now();
+    }
+
+    if (m_logger->is_debug_enabled()) {
+        m_logger->log_debug(
+            "Performing request: op=" + std::to_string(int(op)) + ", req_id=" + std::to_string(req_id));
+    }
+
+    bool sent = m_pool->send(m_id, std::move(message));
+    if (!sent) {
+        remove_unsent_handler(req_id);
+        return false;
+    }
+    return true;
+}
+
+void node_connection::send_queued(std::vector<queued_request> requests) {
+    for (auto &request : requests) {
+        if (m_logger->is_debug_enabled()) {
+            m_logger->log_debug("Performing queued request: op=" + std::to_string(int(request.op))
+                + ", req_id=" + std::to_string(request.req_id));
+        }
+
+        if (m_pool->send(m_id, std::move(request.message)))
+            continue;
+
+        auto handler = get_and_remove_handler(request.req_id, false);
+        if (!handler)
+            continue;
+
+        auto res = handler->set_error(ignite_error("Connection closed before request was sent"));
+        if (res.has_error())
+            m_logger->log_error(
+                "Uncaught user callback exception while handling operation error: " + res.error().what_str());
+    }
+}
+
+std::optional<concurrency_limit_statistics> node_connection::get_concurrency_limit_statistics() {
+    if (!m_limiter)
+        return std::nullopt;
+
+    std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
 
-    auto res = std::move(it->second);
-    m_request_handlers.erase(it);
+    concurrency_limit_statistics res;
+    res.node_name = m_node_name;
+    res.limit = m_limiter->get_limit();
+    res.in_flight = m_limiter->get_in_flight();
+    res.queued = m_queue.size();
+    res.rejected = m_rejected;
 
     return res;
 }
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <ignite/client/concurrency_limit_statistics.h>
 #include <ignite/client/detail/client_operation.h>
+#include <ignite/client/detail/concurrency_limiter.h>
 #include <ignite/client/detail/protocol_context.h>
 #include <ignite/client/detail/response_handler.h>
 #include <ignite/client/ignite_client_configuration.h>
@@ -28,10 +30,16 @@
 #include <ignite/protocol/writer.h>
 
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ignite::detail {
 
@@ -87,17 +95,15 @@ public:
     [[nodiscard]] bool is_handshake_complete() const { return m_handshake_complete; }
 
     /**
-     * Send request.
+     * Serialize request.
      *
-     * @tparam T Result type.
      * @param op Operation code.
      * @param wr Writer function.
-     * @param handler response handler.
-     * @return @c true on success and @c false otherwise.
+     * @return Request ID and the serialized message.
      */
-    bool perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
-        std::shared_ptr<response_handler> handler) {
-        auto reqId = generate_request_id();
+    std::pair<int64_t, std::vector<std::byte>> make_request(
+        client_operation op, const std::function<void(protocol::writer &)> &wr) {
+        auto req_id = generate_request_id();
         std::vector<std::byte> message;
         {
             protocol::buffer_adapter buffer(message);
@@ -105,30 +111,87 @@ public:
 
             protocol::writer writer(buffer);
             writer.write(int32_t(op));
-            writer.write(reqId);
+            writer.write(req_id);
             wr(writer);
 
             buffer.write_length_header();
         }
 
+        return {req_id, std::move(message)};
+    }
+
+    /**
+     * Make a copy of a serialized request with a new request ID of this connection.
+     *
+     * Only the header is written anew, the payload is copied as is, so a request can be sent again, also to another
+     * node, without serializing it one more time.
+     *
+     * @param message Message created with make_request() of any connection.
+     * @return Request ID and message.
+     */
+    std::pair<int64_t, std::vector<std::byte>> reframe_request(bytes_view message) {
+        auto frame = bytes_view(message.substr(protocol::buffer_adapter::LENGTH_HEADER_SIZE));
+
+        protocol::reader reader(frame);
+        auto op = client_operation(reader.read_int32());
+        UNUSED_VALUE reader.read_int64();
+        auto payload = bytes_view(frame.substr(reader.position()));
+
+        return make_request(op, [&payload](protocol::writer &writer) { writer.write_raw(payload); });
+    }
+
+    /**
+     * Send previously serialized request.
+     *
+     * The handler is never called from within this method, so it is safe to call it with the locks the handler takes
+     * held.
+     *
+     * @throw ignite_error if the request is rejected because the concurrency limit is reached and the queue is full.
+     * @param op Operation code.
+     * @param req_id Request ID.
+     * @param message Message created with make_request().
+     * @param handler response handler.
+     * @return @c true on success and @c false otherwise.
+     */
+    bool send_request(client_operation op, int64_t req_id, std::vector<std::byte> message,
+        std::shared_ptr<response_handler> handler) {
+        if (m_limiter)
+            return send_request_limited(op, req_id, std::move(message), std::move(handler));
+
         {
             std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
-            m_request_handlers[reqId] = std::move(handler);
+            m_request_handlers[req_id] = std::move(handler);
         }
 
         if (m_logger->is_debug_enabled()) {
             m_logger->log_debug(
-                "Performing request: op=" + std::to_string(int(op)) + ", req_id=" + std::to_string(reqId));
+                "Performing request: op=" + std::to_string(int(op)) + ", req_id=" + std::to_string(req_id));
         }
 
         bool sent = m_pool->send(m_id, std::move(message));
         if (!sent) {
-            get_and_remove_handler(reqId);
+            remove_unsent_handler(req_id);
             return false;
         }
         return true;
     }
 
+    /**
+     * Send request.
+     *
+     * @throw ignite_error if the request is rejected because the concurrency limit is reached and the queue is full.
+     * @param op Operation code.
+     * @param wr Writer function.
+     * @param handler response handler.
+     * @return @c true on success and @c false otherwise.
+     */
+    bool perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        std::shared_ptr<response_handler> handler) {
+        auto [req_id, message] = make_request(op, wr);
+
+        return send_request(op, req_id, std::move(message), std::move(handler));
+    }
+
     /**
      * Perform request.
      *
@@ -190,7 +253,31 @@ public:
      */
     const protocol_context &get_protocol_context() const { return m_protocol_context; }
 
+    /**
+     * Get concurrency limit statistics.
+     *
+     * @return Concurrency limit statistics or @c std::nullopt if the concurrency limit is disabled.
+     */
+    [[nodiscard]] std::optional<concurrency_limit_statistics> get_concurrency_limit_statistics();
+
 private:
+    /**
+     * Request which waits for the concurrency limit.
+     */
+    struct queued_request {
+        /** Operation code. */
+        client_operation op;
+
+        /** Request ID. */
+        int64_t req_id;
+
+        /** Serialized message. */
+        std::vector<std::byte> message;
+
+        /** Response handler. */
+        std::shared_ptr<response_handler> handler;
+    };
+
     /**
      * Constructor.
      *
@@ -213,9 +300,50 @@ private:
      * Get and remove request handler.
      *
      * @param reqId Request ID.
+     * @param responded @c true if the response for the request was received.
      * @return Handler.
      */
-    std::shared_ptr<response_handler> get_and_remove_handler(int64_t req_id);
+    std::shared_ptr<response_handler> get_and_remove_handler(int64_t req_id, bool responded = true);
+
+    /**
+     * Remove the handler of a request which could not be sent and release its slot. Unlike get_and_remove_handler(),
+     * does not send the queued requests, as the connection is closed anyway.
+     *
+     * @param req_id Request ID.
+     */
+    void remove_unsent_handler(int64_t req_id);
+
+    /**
+     * Check whether the requests of the operation are subject to the concurrency limit.
+     *
+     * Only key-value operations are limited: they are short, so their round-trip time reflects the load of the node.
+     * SQL and compute requests can take arbitrary time on the server, so they neither hold slots nor provide samples.
+     *
+     * @param op Operation code.
+     * @return @c true if the requests of the operation are limited.
+     */
+    [[nodiscard]] static bool is_limited(client_operation op);
+
+    /**
+     * Send previously serialized request, or queue it if the concurrency limit is reached or other requests are
+     * queued already, so that the requests are sent in order.
+     *
+     * @throw ignite_error if the request is rejected because the concurrency limit is reached and the queue is full.
+     * @param op Operation code.
+     * @param req_id Request ID.
+     * @param message Message created with make_request().
+     * @param handler response handler.
+     * @return @c true on success and @c false otherwise.
+     */
+    bool send_request_limited(
+        client_operation op, int64_t req_id, std::vector<std::byte> message, std::shared_ptr<response_handler> handler);
+
+    /**
+     * Send requests taken from the queue.
+     *
+     * @param requests Requests.
+     */
+    void send_queued(std::vector<queued_request> requests);
 
     /** Handshake complete. */
     bool m_handshake_complete{false};
@@ -243,6 +371,21 @@ private:
 
     /** Configuration. */
     const ignite_client_configuration& m_configuration;
+
+    /** Name of the node. */
+    std::string m_node_name;
+
+    /** Concurrency limiter. @c nullptr if the concurrency limit is disabled. Guarded by the handlers mutex. */
+    std::unique_ptr<concurrency_limiter> m_limiter;
+
+    /** Send times of the limited requests in flight. Only tracked with the concurrency limit. */
+    std::unordered_map<int64_t, std::chrono::steady_clock::time_point> m_send_times;
+
+    /** Requests which wait for the concurrency limit. */
+    std::deque<queued_request> m_queue;
+
+    /** Number of requests which failed because the queue was full. */
+    int64_t m_rejected{0};
 };
 
 } // namespace ignite::detail
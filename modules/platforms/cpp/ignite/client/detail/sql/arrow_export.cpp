@@ -0,0 +1,629 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arrow_export.h"
+
+#include "ignite/common/bytes.h"
+#include "ignite/common/ignite_error.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace ignite::detail {
+
+namespace {
+
+/** Nanoseconds in a second. */
+constexpr std::int64_t NANOS_PER_SECOND = 1'000'000'000;
+
+/** Seconds in a day. */
+constexpr std::int64_t SECONDS_PER_DAY = 86'400;
+
+/** Maximum precision of the 128-bit Arrow decimal. */
+constexpr std::int32_t DECIMAL128_MAX_PRECISION = 38;
+
+/**
+ * Data of an exported schema, owned by the schema.
+ */
+struct schema_data {
+    /** Format string. */
+    std::string format;
+
+    /** Field name. */
+    std::string name;
+
+    /** Children. */
+    std::vector<std::unique_ptr<ArrowSchema>> children;
+
+    /** Pointers to children. */
+    std::vector<ArrowSchema *> child_ptrs;
+
+    /**
+     * Destructor. Releases children which were not moved by the consumer.
+     */
+    ~schema_data() {
+        for (auto &child : children) {
+            if (child->release)
+                child->release(child.get());
+        }
+    }
+};
+
+/**
+ * Data of an exported array, owned by the array.
+ */
+struct array_data {
+    /** Validity bitmap. */
+    std::vector<std::byte> validity;
+
+    /** Offsets of variable-length values. */
+    std::vector<std::int32_t> offsets;
+
+    /** Values. */
+    std::vector<std::byte> values;
+
+    /** Buffer pointers. */
+    std::array<const void *, 3> buffers{};
+
+    /** Children. */
+    std::vector<std::unique_ptr<ArrowArray>> children;
+
+    /** Pointers to children. */
+    std::vector<ArrowArray *> child_ptrs;
+
+    /**
+     * Destructor. Releases children which were not moved by the consumer.
+     */
+    ~array_data() {
+        for (auto &child : children) {
+            if (child->release)
+                child->release(child.get());
+        }
+    }
+};
+
+/**
+ * Release callback of exported schemas.
+ *
+ * @param schema Schema.
+ */
+void release_schema(ArrowSchema *schema) {
+    delete static_cast<schema_data *>(schema->private_data);
+    schema->release = nullptr;
+}
+
+/**
+ * Release callback of exported arrays.
+ *
+ * @param array Array.
+ */
+void release_array(ArrowArray *array) {
+    delete static_cast<array_data *>(array->private_data);
+    array->release = nullptr;
+}
+
+/**
+ * Fill the schema struct, passing the data ownership to it.
+ *
+ * @param data Schema data.
+ * @param flags Flags.
+ * @param out Schema to fill.
+ */
+void fill_schema(std::unique_ptr<schema_data> data, std::int64_t flags, ArrowSchema *out) {
+    out->format = data->format.c_str();
+    out->name = data->name.c_str();
+    out->metadata = nullptr;
+    out->flags = flags;
+    out->n_children = std::int64_t(data->child_ptrs.size());
+    out->children = data->child_ptrs.empty() ? nullptr : data->child_ptrs.data();
+    out->dictionary = nullptr;
+    out->release = release_schema;
+    out->private_data = data.release();
+}
+
+/**
+ * Fill the array struct, passing the data ownership to it.
+ *
+ * @param data Array data.
+ * @param length Number of elements.
+ * @param null_count Number of null elements.
+ * @param n_buffers Number of buffers.
+ * @param out Array to fill.
+ */
+void fill_array(
+    std::unique_ptr<array_data> data, std::int64_t length, std::int64_t null_count, int n_buffers, ArrowArray *out) {
+    out->length = length;
+    out->null_count = null_count;
+    out->offset = 0;
+    out->n_buffers = n_buffers;
+    out->n_children = std::int64_t(data->child_ptrs.size());
+    out->buffers = data->buffers.data();
+    out->children = data->child_ptrs.empty() ? nullptr : data->child_ptrs.data();
+    out->dictionary = nullptr;
+    out->release = release_array;
+    out->private_data = data.release();
+}
+
+/**
+ * Gets the byte width of the Arrow decimal used for a column.
+ *
+ * @param precision Column precision.
+ * @return Byte width.
+ */
+std::size_t decimal_width(std::int32_t precision) {
+    return precision <= DECIMAL128_MAX_PRECISION ? 16 : 32;
+}
+
+/**
+ * Gets the Arrow format string of a column.
+ *
+ * @param column Column.
+ * @return Format string.
+ */
+std::string arrow_format(const column_metadata &column) {
+    switch (column.type()) {
+        case ignite_type::BOOLEAN:
+            return "b";
+        case ignite_type::INT8:
+            return "c";
+        case ignite_type::INT16:
+            return "s";
+        case ignite_type::INT32:
+            return "i";
+        case ignite_type::INT64:
+            return "l";
+        case ignite_type::FLOAT:
+            return "f";
+        case ignite_type::DOUBLE:
+            return "g";
+        case ignite_type::DECIMAL: {
+            auto format = "d:" + std::to_string(column.precision()) + "," + std::to_string(column.scale());
+            if (decimal_width(column.precision()) == 32)
+                format += ",256";
+            return format;
+        }
+        case ignite_type::DATE:
+            return "tdD";
+        case ignite_type::TIME:
+            return "ttn";
+        case ignite_type::DATETIME:
+            return "tsn:";
+        case ignite_type::TIMESTAMP:
+            return "tsn:UTC";
+        case ignite_type::UUID:
+            return "w:16";
+        case ignite_type::STRING:
+            return "u";
+        case ignite_type::BYTE_ARRAY:
+        case ignite_type::BITMASK:
+            return "z";
+        case ignite_type::PERIOD:
+            return "tin";
+        case ignite_type::DURATION:
+            return "tDn";
+        default:
+            throw ignite_error("Type with id " + std::to_string(int(column.type()))
+                + " is not supported by Arrow export, column: " + column.name());
+    }
+}
+
+/**
+ * Convert seconds and nanoseconds to nanoseconds.
+ *
+ * @param seconds Seconds.
+ * @param nanos Nanoseconds.
+ * @return Total nanoseconds.
+ */
+std::int64_t to_nanos(std::int64_t seconds, std::int32_t nanos) {
+    constexpr auto max_seconds = std::numeric_limits<std::int64_t>::max() / NANOS_PER_SECOND - 1;
+    if (seconds > max_seconds || seconds < -max_seconds)
+        throw ignite_error("Value is out of the range of Arrow nanosecond types: " + std::to_string(seconds) + "s");
+
+    return seconds * NANOS_PER_SECOND + nanos;
+}
+
+/**
+ * Gets the number of days since the epoch.
+ *
+ * @param date Date.
+ * @return Days since 1970-01-01.
+ */
+std::int64_t epoch_days(const ignite_date &date) {
+    // Days from the civil date, as described in http://howardhinnant.github.io/date_algorithms.html
+    std::int64_t year = date.get_year();
+    std::int64_t month = date.get_month();
+    std::int64_t day = date.get_day_of_month();
+
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const std::int64_t year_of_era = year - era * 400;
+    const std::int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const std::int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+    return era * 146097 + day_of_era - 719468;
+}
+
+/**
+ * Gets the number of nanoseconds since midnight.
+ *
+ * @param time Time.
+ * @return Nanoseconds since midnight.
+ */
+std::int64_t day_nanos(const ignite_time &time) {
+    std::int64_t seconds = (std::int64_t(time.get_hour()) * 60 + time.get_minute()) * 60 + time.get_second();
+    return seconds * NANOS_PER_SECOND + time.get_nano();
+}
+
+/**
+ * Rows of the exported page with offset tables decoded up front.
+ *
+ * Offset tables of all the rows are widened once, so reading a value of any column is a couple of array lookups.
+ */
+struct decoded_rows {
+    /** Row parsers. */
+    std::vector<binary_tuple_parser> parsers;
+
+    /** Value areas of the rows. */
+    std::vector<bytes_view> value_areas;
+
+    /** End offsets of the values in the value areas, row by row. */
+    std::vector<tuple_size_t> ends;
+
+    /** Number of columns in every row. */
+    std::size_t columns_num{0};
+
+    /**
+     * Gets the number of rows.
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] std::size_t size() const { return parsers.size(); }
+
+    /**
+     * Gets the column value of a row.
+     *
+     * @param row Row index.
+     * @param idx Column index.
+     * @return Value, or @c std::nullopt if null.
+     */
+    [[nodiscard]] std::optional<bytes_view> get(std::size_t row, std::int32_t idx) const {
+        const auto *row_ends = ends.data() + row * columns_num;
+        tuple_size_t begin = idx ? row_ends[idx - 1] : 0;
+        tuple_size_t end = row_ends[idx];
+
+        if (begin == end && parsers[row].is_null(tuple_num_t(idx)))
+            return std::nullopt;
+
+        return value_areas[row].substr(begin, end - begin);
+    }
+};
+
+/**
+ * Column exporter.
+ *
+ * Decodes a single column of all the rows.
+ */
+class column_exporter {
+public:
+    /**
+     * Constructor.
+     *
+     * @param rows Row parsers.
+     * @param idx Column index.
+     */
+    column_exporter(const decoded_rows &rows, std::int32_t idx)
+        : m_rows(rows)
+        , m_idx(idx)
+        , m_data(std::make_unique<array_data>()) {}
+
+    /**
+     * Export the column.
+     *
+     * @param column Column.
+     * @param out Array to fill.
+     */
+    void export_column(const column_metadata &column, ArrowArray *out) {
+        switch (column.type()) {
+            case ignite_type::BOOLEAN:
+                return export_bits(out);
+            case ignite_type::INT8:
+                return export_fixed<std::int8_t>(out, binary_tuple_parser::get_int8);
+            case ignite_type::INT16:
+                return export_fixed<std::int16_t>(out, binary_tuple_parser::get_int16);
+            case ignite_type::INT32:
+                return export_fixed<std::int32_t>(out, binary_tuple_parser::get_int32);
+            case ignite_type::INT64:
+                return export_fixed<std::int64_t>(out, binary_tuple_parser::get_int64);
+            case ignite_type::FLOAT:
+                return export_fixed<float>(out, binary_tuple_parser::get_float);
+            case ignite_type::DOUBLE:
+                return export_fixed<double>(out, binary_tuple_parser::get_double);
+            case ignite_type::DECIMAL:
+                return export_decimal(out, decimal_width(column.precision()));
+            case ignite_type::DATE:
+                return export_fixed<std::int32_t>(
+                    out, [](bytes_view val) { return std::int32_t(epoch_days(binary_tuple_parser::get_date(val))); });
+            case ignite_type::TIME:
+                return export_fixed<std::int64_t>(
+                    out, [](bytes_view val) { return day_nanos(binary_tuple_parser::get_time(val)); });
+            case ignite_type::DATETIME:
+                return export_fixed<std::int64_t>(out, [](bytes_view val) {
+                    auto value = binary_tuple_parser::get_date_time(val);
+                    auto seconds = epoch_days(value.date()) * SECONDS_PER_DAY;
+                    return to_nanos(seconds, 0) + day_nanos(value.time());
+                });
+            case ignite_type::TIMESTAMP:
+                return export_fixed<std::int64_t>(out, [](bytes_view val) {
+                    auto value = binary_tuple_parser::get_timestamp(val);
+                    return to_nanos(value.get_epoch_second(), value.get_nano());
+                });
+            case ignite_type::UUID:
+                return export_fixed<std::array<std::byte, 16>>(out, [](bytes_view val) {
+                    auto value = binary_tuple_parser::get_uuid(val);
+                    std::array<std::byte, 16> res{};
+                    bytes::store<endian::BIG>(res.data(), value.get_most_significant_bits());
+                    bytes::store<endian::BIG>(res.data() + 8, value.get_least_significant_bits());
+                    return res;
+                });
+            case ignite_type::STRING:
+            case ignite_type::BYTE_ARRAY:
+            case ignite_type::BITMASK:
+                return export_binary(out);
+            case ignite_type::PERIOD:
+                return export_fixed<month_day_nano>(out, [](bytes_view val) {
+                    auto value = binary_tuple_parser::get_period(val);
+                    auto months = std::int64_t(value.get_years()) * 12 + value.get_months();
+                    if (months > std::numeric_limits<std::int32_t>::max()
+                        || months < std::numeric_limits<std::int32_t>::min())
+                        throw ignite_error("Period is out of the range of Arrow intervals");
+
+                    return month_day_nano{std::int32_t(months), value.get_days(), 0};
+                });
+            case ignite_type::DURATION:
+                return export_fixed<std::int64_t>(out, [](bytes_view val) {
+                    auto value = binary_tuple_parser::get_duration(val);
+                    return to_nanos(value.get_seconds(), value.get_nano());
+                });
+            default:
+                // Rejected when the format is determined.
+                assert(false);
+        }
+    }
+
+private:
+    /** Arrow month-day-nanosecond interval. */
+    struct month_day_nano {
+        std::int32_t months;
+        std::int32_t days;
+        std::int64_t nanos;
+    };
+
+    /**
+     * Gets the column value of a row, tracking nulls.
+     *
+     * @param row Row index.
+     * @return Value, or @c std::nullopt if null.
+     */
+    std::optional<bytes_view> get(std::size_t row) {
+        auto val = m_rows.get(row, m_idx);
+        if (!val) {
+            if (m_data->validity.empty())
+                m_data->validity.assign((m_rows.size() + 7) / 8, std::byte{0xFF});
+
+            m_data->validity[row / 8] &= ~(std::byte{1} << (row % 8));
+            ++m_null_count;
+        }
+
+        return val;
+    }
+
+    /**
+     * Finish the export.
+     *
+     * @param n_buffers Number of buffers.
+     * @param out Array to fill.
+     */
+    void finish(int n_buffers, ArrowArray *out) {
+        // Consumers may expect non-null buffers even for empty arrays.
+        static const std::int64_t empty_buffer = 0;
+
+        const void *values = m_data->values.data();
+        if (m_data->values.empty())
+            values = &empty_buffer;
+
+        m_data->buffers[0] = m_null_count ? m_data->validity.data() : nullptr;
+        if (n_buffers == 3) {
+            m_data->buffers[1] = m_data->offsets.data();
+            m_data->buffers[2] = values;
+        } else {
+            m_data->buffers[1] = values;
+        }
+
+        fill_array(std::move(m_data), std::int64_t(m_rows.size()), m_null_count, n_buffers, out);
+    }
+
+    /**
+     * Export a fixed-width column.
+     *
+     * @tparam T Arrow value type.
+     * @param out Array to fill.
+     * @param read Value reader.
+     */
+    template<typename T, typename F>
+    void export_fixed(ArrowArray *out, F read) {
+        m_data->values.resize(m_rows.size() * sizeof(T));
+        auto *dst = m_data->values.data();
+
+        for (std::size_t row = 0; row < m_rows.size(); ++row, dst += sizeof(T)) {
+            auto val = get(row);
+            if (val) {
+                T value = read(*val);
+                std::memcpy(dst, &value, sizeof(T));
+            }
+        }
+
+        finish(2, out);
+    }
+
+    /**
+     * Export a boolean column.
+     *
+     * @param out Array to fill.
+     */
+    void export_bits(ArrowArray *out) {
+        m_data->values.assign((m_rows.size() + 7) / 8, std::byte{0});
+
+        for (std::size_t row = 0; row < m_rows.size(); ++row) {
+            auto val = get(row);
+            if (val && binary_tuple_parser::get_bool(*val))
+                m_data->values[row / 8] |= std::byte{1} << (row % 8);
+        }
+
+        finish(2, out);
+    }
+
+    /**
+     * Export a decimal column.
+     *
+     * @param out Array to fill.
+     * @param width Byte width of values.
+     */
+    void export_decimal(ArrowArray *out, std::size_t width) {
+        m_data->values.resize(m_rows.size() * width);
+        auto *dst = m_data->values.data();
+
+        for (std::size_t row = 0; row < m_rows.size(); ++row, dst += width) {
+            auto val = get(row);
+            if (!val)
+                continue;
+
+            // Binary tuples store the unscaled value as a big-endian two's complement number, while Arrow decimals
+            // are fixed-width two's complement numbers in the native byte order.
+            if (val->size() > width)
+                throw ignite_error("Decimal value is too large for Arrow export: " + std::to_string(val->size())
+                    + " bytes, column index: " + std::to_string(m_idx));
+
+            auto sign = !val->empty() && (val->front() & std::byte{0x80}) != std::byte{0} ? std::byte{0xFF}
+                                                                                           : std::byte{0};
+            std::reverse_copy(val->begin(), val->end(), dst);
+            std::fill(dst + val->size(), dst + width, sign);
+
+            if constexpr (!is_little_endian_platform())
+                std::reverse(dst, dst + width);
+        }
+
+        finish(2, out);
+    }
+
+    /**
+     * Export a variable-length column.
+     *
+     * @param out Array to fill.
+     */
+    void export_binary(ArrowArray *out) {
+        m_data->offsets.resize(m_rows.size() + 1);
+        m_data->offsets[0] = 0;
+
+        for (std::size_t row = 0; row < m_rows.size(); ++row) {
+            auto val = get(row);
+            if (val)
+                m_data->values.insert(m_data->values.end(), val->begin(), val->end());
+
+            if (m_data->values.size() > std::size_t(std::numeric_limits<std::int32_t>::max()))
+                throw ignite_error("Column data is too large for Arrow export, column index: "
+                    + std::to_string(m_idx));
+
+            m_data->offsets[row + 1] = std::int32_t(m_data->values.size());
+        }
+
+        finish(3, out);
+    }
+
+    /** Rows. */
+    const decoded_rows &m_rows;
+
+    /** Column index. */
+    const std::int32_t m_idx;
+
+    /** Array data. */
+    std::unique_ptr<array_data> m_data;
+
+    /** Number of nulls. */
+    std::int64_t m_null_count{0};
+};
+
+} // namespace
+
+void export_arrow_schema(const std::vector<column_metadata> &columns, ArrowSchema *out) {
+    auto data = std::make_unique<schema_data>();
+    data->format = "+s";
+    data->children.reserve(columns.size());
+    data->child_ptrs.reserve(columns.size());
+
+    for (const auto &column : columns) {
+        auto child_data = std::make_unique<schema_data>();
+        child_data->format = arrow_format(column);
+        child_data->name = column.name();
+
+        auto &child = data->children.emplace_back(std::make_unique<ArrowSchema>());
+        fill_schema(std::move(child_data), column.nullable() ? ARROW_FLAG_NULLABLE : 0, child.get());
+        data->child_ptrs.push_back(child.get());
+    }
+
+    fill_schema(std::move(data), 0, out);
+}
+
+void export_arrow_array(
+    const std::vector<column_metadata> &columns, const tuple_page &page, std::size_t first_row, ArrowArray *out) {
+    auto rows_num = page.row_count() - std::min(first_row, page.row_count());
+
+    decoded_rows rows;
+    rows.columns_num = columns.size();
+    rows.parsers.reserve(rows_num);
+    rows.value_areas.reserve(rows_num);
+    rows.ends.resize(rows_num * rows.columns_num);
+
+    for (std::size_t row = first_row; row < page.row_count(); ++row) {
+        auto &parser = rows.parsers.emplace_back(page.make_parser(row));
+        assert(std::size_t(parser.num_elements()) == rows.columns_num);
+
+        parser.decode_offsets(rows.ends.data() + (row - first_row) * rows.columns_num);
+        rows.value_areas.push_back(parser.get_value_area());
+    }
+
+    auto data = std::make_unique<array_data>();
+    data->children.reserve(columns.size());
+    data->child_ptrs.reserve(columns.size());
+
+    for (std::int32_t idx = 0; idx < std::int32_t(columns.size()); ++idx) {
+        // Validates the column type.
+        (void) arrow_format(columns[idx]);
+
+        auto &child = data->children.emplace_back(std::make_unique<ArrowArray>());
+        column_exporter(rows, idx).export_column(columns[idx], child.get());
+        data->child_ptrs.push_back(child.get());
+    }
+
+    fill_array(std::move(data), std::int64_t(rows.size()), 0, 1, out);
+}
+
+} // namespace ignite::detail
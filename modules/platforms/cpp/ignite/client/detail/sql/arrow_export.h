@@ -0,0 +1,52 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/table/tuple_page.h"
+#include "ignite/client/sql/arrow.h"
+#include "ignite/client/sql/column_metadata.h"
+
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Export the schema of result set rows using the Arrow C Data Interface.
+ *
+ * Rows are described as a struct with a child field for every column.
+ *
+ * @param columns Result set columns.
+ * @param out Schema to fill. Released by the consumer.
+ */
+void export_arrow_schema(const std::vector<column_metadata> &columns, ArrowSchema *out);
+
+/**
+ * Export result set rows using the Arrow C Data Interface.
+ *
+ * Rows are exported as a struct array with a child array for every column. Columns are decoded one at a time from
+ * the binary tuples of the page directly into contiguous validity, offset and value buffers.
+ *
+ * @param columns Result set columns.
+ * @param page Rows to export.
+ * @param first_row Index of the first row of the page to export.
+ * @param out Array to fill. Released by the consumer.
+ */
+void export_arrow_array(
+    const std::vector<column_metadata> &columns, const tuple_page &page, std::size_t first_row, ArrowArray *out);
+
+} // namespace ignite::detail
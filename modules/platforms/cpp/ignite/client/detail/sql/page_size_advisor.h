@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/sql/sql_statement.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ignite::detail {
+
+/**
+ * Chooses page sizes of queries which target a number of bytes per page.
+ *
+ * Keeps a moving average of the row size of every query, updated from the received pages. The page size of the
+ * next execution of the query is the number of such rows that fit in the target page size.
+ */
+class page_size_advisor {
+public:
+    /** Maximum page size chosen by the advisor. */
+    static constexpr std::int32_t MAX_PAGE_SIZE{64 * 1024};
+
+    /** Maximum number of queries to keep row size estimates for. */
+    static constexpr std::size_t MAX_QUERIES{1024};
+
+    /** Weight of the row size of a new page in the moving average. */
+    static constexpr double NEW_PAGE_WEIGHT{0.25};
+
+    /**
+     * Choose the page size for the statement.
+     *
+     * @param statement Statement.
+     * @return Page size in rows.
+     */
+    [[nodiscard]] std::int32_t page_size(const sql_statement &statement) {
+        if (!statement.target_page_bytes())
+            return statement.page_size();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_row_sizes.find(statement.query());
+        if (it == m_row_sizes.end())
+            return statement.page_size();
+
+        auto rows = double(statement.target_page_bytes()) / std::max(it->second, 1.0);
+
+        return std::int32_t(std::clamp(rows, 1.0, double(MAX_PAGE_SIZE)));
+    }
+
+    /**
+     * Update the row size estimate of the query with a received page.
+     *
+     * @param query Query text.
+     * @param rows Number of rows in the page.
+     * @param bytes Size of the rows in bytes.
+     */
+    void on_page(const std::string &query, std::size_t rows, std::size_t bytes) {
+        if (!rows)
+            return;
+
+        auto row_size = double(bytes) / double(rows);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_row_sizes.find(query);
+        if (it != m_row_sizes.end()) {
+            it->second += (row_size - it->second) * NEW_PAGE_WEIGHT;
+            return;
+        }
+
+        // Estimates are cheap to rebuild, so the whole map is dropped once it grows too large.
+        if (m_row_sizes.size() >= MAX_QUERIES)
+            m_row_sizes.clear();
+
+        m_row_sizes.emplace(query, row_size);
+    }
+
+private:
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Average row sizes by query text. */
+    std::unordered_map<std::string, double> m_row_sizes;
+};
+
+} // namespace ignite::detail
@@ -18,12 +18,19 @@
 #pragma once
 
 #include "ignite/client/detail/node_connection.h"
+#include "ignite/client/detail/sql/arrow_export.h"
+#include "ignite/client/detail/sql/page_size_advisor.h"
+#include "ignite/client/detail/table/tuple_page.h"
 #include "ignite/client/detail/utils.h"
 #include "ignite/client/sql/result_set_metadata.h"
+#include "ignite/client/sql/result_set_statistics.h"
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/tuple/binary_tuple_parser.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <deque>
+#include <mutex>
 
 namespace ignite::detail {
 
@@ -40,9 +47,22 @@ public:
      *
      * @param connection Node connection.
      * @param data Row set data.
+     * @param prefetch_depth Maximum number of pages to fetch ahead of the consumer.
+     * @param prefetch_max_bytes Maximum total size of prefetched pages.
+     * @param page_size Page size requested for the query.
+     * @param advisor Page size advisor to report received pages to.
+     * @param query Query text.
      */
-    result_set_impl(std::shared_ptr<node_connection> connection, bytes_view data)
-        : m_connection(std::move(connection)) {
+    result_set_impl(std::shared_ptr<node_connection> connection, bytes_view data, std::int32_t prefetch_depth = 0,
+        std::size_t prefetch_max_bytes = 0, std::int32_t page_size = 0,
+        std::shared_ptr<page_size_advisor> advisor = nullptr, std::string query = {})
+        : m_connection(std::move(connection))
+        , m_prefetch_depth(std::size_t(std::max(prefetch_depth, 0)))
+        , m_prefetch_max_bytes(prefetch_max_bytes)
+        , m_advisor(std::move(advisor))
+        , m_query(std::move(query)) {
+        m_statistics.page_size = page_size;
+
         protocol::reader reader(data);
 
         m_resource_id = reader.read_object_nullable<std::int64_t>();
@@ -54,7 +74,9 @@ public:
         if (m_has_rowset) {
             auto columns = read_meta(reader);
             m_meta = result_set_metadata(columns);
-            m_page = read_page(reader, m_meta);
+            m_row_schema = make_row_schema(m_meta);
+            set_page(read_page(reader, m_row_schema));
+            on_page_received(*m_page);
         }
     }
 
@@ -95,6 +117,14 @@ public:
      */
     [[nodiscard]] bool was_applied() const { return m_was_applied; }
 
+    /**
+     * Check whether all the rows were received with the first page, so the result set does not hold any server
+     * resources.
+     *
+     * @return @c true if the result set is complete.
+     */
+    [[nodiscard]] bool is_complete() const { return m_has_rowset && !m_has_more_pages && !m_resource_id; }
+
     /**
      * Close result set asynchronously.
      *
@@ -102,16 +132,25 @@ public:
      * @return @c true if the request was sent, and false if the result set was already closed.
      */
     bool close_async(std::function<void(ignite_result<void>)> callback) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Prefetched pages are dropped, and the response to an outstanding prefetch request is discarded.
+        m_closing = true;
+        m_prefetched.clear();
+        m_prefetched_bytes = 0;
+
         if (!m_resource_id)
             return false;
 
         auto writer_func = [id = m_resource_id.value()](protocol::writer &writer) { writer.write(id); };
+        lock.unlock();
 
         auto reader_func = [weak_self = weak_from_this()](protocol::reader &) {
             auto self = weak_self.lock();
             if (!self)
                 return;
 
+            std::lock_guard<std::mutex> lock(self->m_mutex);
             self->m_resource_id = std::nullopt;
         };
 
@@ -143,47 +182,151 @@ public:
     [[nodiscard]] std::vector<ignite_tuple> current_page() {
         require_result_set();
 
-        auto ret = std::move(m_page);
-        m_page.clear();
+        std::vector<ignite_tuple> ret;
+        if (m_page) {
+            ret.reserve(m_page->row_count() - m_page_row);
+            for (auto row = m_page_row; row < m_page->row_count(); ++row)
+                ret.emplace_back(m_page->get_row(row));
+
+            m_page.reset();
+        }
 
         return ret;
     }
 
+    /**
+     * Get the next row, fetching the next page synchronously when the current one is exhausted.
+     *
+     * Rows are taken from the current page one at a time, and each row is decoded on access.
+     *
+     * @return The next row or @c std::nullopt if there are no more rows.
+     */
+    [[nodiscard]] std::optional<ignite_tuple> next_row() {
+        require_result_set();
+
+        while (!m_page || m_page_row >= m_page->row_count()) {
+            m_page.reset();
+            if (!has_more_pages())
+                return std::nullopt;
+
+            sync<void>([this](auto callback) { fetch_next_page_async(std::move(callback)); });
+        }
+
+        return m_page->get_row(m_page_row++);
+    }
+
+    /**
+     * Export current page using the Arrow C Data Interface.
+     *
+     * @param schema Schema to fill.
+     * @param array Array to fill.
+     */
+    void current_page_arrow(ArrowSchema *schema, ArrowArray *array) {
+        require_result_set();
+
+        export_arrow_schema(m_meta.columns(), schema);
+        try {
+            if (m_page)
+                export_arrow_array(m_meta.columns(), *m_page, m_page_row, array);
+            else
+                export_arrow_array(m_meta.columns(), tuple_page(m_row_schema, false), 0, array);
+        } catch (...) {
+            schema->release(schema);
+            throw;
+        }
+
+        m_page.reset();
+    }
+
+    /**
+     * Gets statistics of the pages received so far.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] result_set_statistics statistics() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_statistics;
+    }
+
     /**
      * Checks whether there are more pages of results.
      *
      * @return @c true if there are more pages with results and @c false otherwise.
      */
-    [[nodiscard]] IGNITE_API bool has_more_pages() { return m_resource_id.has_value() && m_has_more_pages; }
+    [[nodiscard]] IGNITE_API bool has_more_pages() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return !m_prefetched.empty() || m_fetch_error || (m_resource_id.has_value() && m_has_more_pages);
+    }
 
     /**
      * Fetch the next page of results asynchronously.
      * The current page is changed after the operation is complete.
      *
+     * A page that was already prefetched becomes current immediately. If the next page is being prefetched, the
+     * callback is called once it arrives.
+     *
      * @param callback Callback to call on completion.
      */
     IGNITE_API void fetch_next_page_async(std::function<void(ignite_result<void>)> callback) {
         require_result_set();
 
-        if (!m_resource_id)
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_fetch_error) {
+            ignite_error err = std::move(*m_fetch_error);
+            m_fetch_error.reset();
+            lock.unlock();
+
+            callback(std::move(err));
+            return;
+        }
+
+        if (!m_prefetched.empty()) {
+            take_prefetched();
+            auto prefetch_id = begin_fetch();
+            lock.unlock();
+
+            if (prefetch_id)
+                send_fetch_request(*prefetch_id);
+
+            callback({});
+            return;
+        }
+
+        if (m_fetch_callback)
+            throw ignite_error("The next page is already being fetched");
+
+        if (m_fetching) {
+            m_fetch_callback = std::move(callback);
+            return;
+        }
+
+        if (!m_resource_id || m_closing)
             throw ignite_error("Query cursor is closed");
 
         if (!m_has_more_pages)
             throw ignite_error("There are no more pages");
 
-        auto writer_func = [id = m_resource_id.value()](protocol::writer &writer) { writer.write(id); };
+        m_fetch_callback = std::move(callback);
+        m_fetching = true;
+        auto id = *m_resource_id;
+        lock.unlock();
 
-        auto reader_func = [weak_self = weak_from_this()](protocol::reader &reader) {
-            auto self = weak_self.lock();
-            if (!self)
-                return;
+        send_fetch_request(id);
+    }
 
-            self->m_page = read_page(reader, self->m_meta);
-            self->m_has_more_pages = reader.read_bool();
-        };
+    /**
+     * Start fetching pages ahead of the consumer, if prefetch is enabled.
+     */
+    void start_prefetch() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto prefetch_id = begin_fetch();
+        lock.unlock();
 
-        m_connection->perform_request<void>(
-            client_operation::SQL_CURSOR_NEXT_PAGE, writer_func, std::move(reader_func), std::move(callback));
+        if (prefetch_id)
+            send_fetch_request(*prefetch_id);
     }
 
 private:
@@ -264,38 +407,178 @@ private:
         return columns;
     }
 
+    /**
+     * Make a schema describing result set rows.
+     *
+     * @param meta Result set metadata.
+     * @return Row schema.
+     */
+    static std::shared_ptr<schema> make_row_schema(const result_set_metadata &meta) {
+        std::vector<column> columns;
+        columns.reserve(meta.columns().size());
+
+        for (const auto &col_meta : meta.columns()) {
+            column col;
+            col.name = col_meta.name();
+            col.type = col_meta.type();
+            col.nullable = col_meta.nullable();
+            col.scale = col_meta.scale();
+            columns.emplace_back(std::move(col));
+        }
+
+        return std::make_shared<schema>(-1, 0, std::move(columns));
+    }
+
     /**
      * Read page.
      *
+     * Rows are not decoded here: the page keeps encoded rows, and tuples are created when rows are requested.
+     *
      * @param reader Reader to use.
+     * @param row_schema Row schema.
      * @return Page.
      */
-    static std::vector<ignite_tuple> read_page(protocol::reader &reader, const result_set_metadata &meta) {
-        auto size = reader.read_array_size();
+    static std::shared_ptr<tuple_page> read_page(protocol::reader &reader, std::shared_ptr<schema> row_schema) {
+        auto page = std::make_shared<tuple_page>(std::move(row_schema), false);
+        reader.read_array_raw([&page](std::uint32_t, const msgpack_object &obj) {
+            page->append_row(protocol::unpack_binary(obj));
+        });
+
+        return page;
+    }
+
+    /**
+     * Make the page current.
+     *
+     * @param page Page.
+     */
+    void set_page(std::shared_ptr<tuple_page> page) {
+        m_page = std::move(page);
+        m_page_row = 0;
+    }
+
+    /**
+     * Account for a page received from the server. Must be called under the lock.
+     *
+     * @param page Page.
+     */
+    void on_page_received(const tuple_page &page) {
+        m_statistics.pages++;
+        m_statistics.rows += std::int64_t(page.row_count());
+        m_statistics.bytes += std::int64_t(page.data_size());
+
+        if (m_advisor)
+            m_advisor->on_page(m_query, page.row_count(), page.data_size());
+    }
+
+    /**
+     * Make the first prefetched page current. Must be called under the lock.
+     */
+    void take_prefetched() {
+        m_prefetched_bytes -= m_prefetched.front()->data_size();
+        set_page(std::move(m_prefetched.front()));
+        m_prefetched.pop_front();
+    }
 
-        std::vector<ignite_tuple> page;
-        page.reserve(size);
+    /**
+     * Check whether the next page should be prefetched, and mark the fetch as started if so. Must be called under
+     * the lock.
+     *
+     * @return Resource ID of the cursor if the fetch request should be sent.
+     */
+    std::optional<std::int64_t> begin_fetch() {
+        bool prefetch = !m_fetching && !m_closing && m_resource_id && m_has_more_pages
+            && m_prefetched.size() < m_prefetch_depth && m_prefetched_bytes < m_prefetch_max_bytes;
 
-        reader.read_array_raw([&columns = meta.columns(), &page](std::uint32_t, const msgpack_object &obj) {
-            auto tuple_data = protocol::unpack_binary(obj);
+        if (!prefetch)
+            return std::nullopt;
 
-            auto columns_cnt = columns.size();
-            ignite_tuple res(columns_cnt);
-            binary_tuple_parser parser(std::int32_t(columns_cnt), tuple_data);
+        m_fetching = true;
+        return m_resource_id;
+    }
+
+    /**
+     * Send the request for the next page. The fetch must be marked as started.
+     *
+     * @param id Resource ID of the cursor.
+     */
+    void send_fetch_request(std::int64_t id) {
+        auto writer_func = [id](protocol::writer &writer) { writer.write(id); };
+
+        auto reader_func = [row_schema = m_row_schema](protocol::reader &reader) {
+            auto page = read_page(reader, row_schema);
+            bool has_more = reader.read_bool();
+
+            return std::make_pair(std::move(page), has_more);
+        };
+
+        auto callback = [weak_self = weak_from_this()](auto &&res) {
+            auto self = weak_self.lock();
+            if (!self)
+                return;
 
-            for (size_t i = 0; i < columns_cnt; ++i) {
-                auto &column = columns[i];
-                res.set(column.name(), read_next_column(parser, column.type(), column.scale()));
+            self->on_page_fetched(std::forward<decltype(res)>(res));
+        };
+
+        bool sent = m_connection->perform_request<std::pair<std::shared_ptr<tuple_page>, bool>>(
+            client_operation::SQL_CURSOR_NEXT_PAGE, writer_func, std::move(reader_func), std::move(callback));
+
+        if (!sent)
+            on_page_fetched(ignite_error("Connection associated with the query cursor is closed"));
+    }
+
+    /**
+     * Handle the response to the request for the next page.
+     *
+     * @param res Page and a flag indicating whether there are more pages, or an error.
+     */
+    void on_page_fetched(ignite_result<std::pair<std::shared_ptr<tuple_page>, bool>> &&res) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_fetching = false;
+        auto callback = std::move(m_fetch_callback);
+        m_fetch_callback = nullptr;
+
+        if (res.has_error()) {
+            auto err = std::move(res).error();
+            if (!callback) {
+                if (!m_closing)
+                    m_fetch_error = std::move(err);
+                return;
             }
-            page.emplace_back(std::move(res));
-        });
 
-        return page;
+            lock.unlock();
+            callback(std::move(err));
+            return;
+        }
+
+        auto [page, has_more] = std::move(res).value();
+        m_has_more_pages = has_more;
+        on_page_received(*page);
+
+        if (callback) {
+            set_page(std::move(page));
+        } else if (!m_closing) {
+            m_prefetched_bytes += page->data_size();
+            m_prefetched.push_back(std::move(page));
+        }
+
+        auto prefetch_id = begin_fetch();
+        lock.unlock();
+
+        if (prefetch_id)
+            send_fetch_request(*prefetch_id);
+
+        if (callback)
+            callback({});
     }
 
     /** Result set metadata. */
     result_set_metadata m_meta;
 
+    /** Schema of the result set rows. */
+    std::shared_ptr<schema> m_row_schema;
+
     /** Has row set. */
     bool m_has_rowset{false};
 
@@ -315,7 +598,46 @@ private:
     bool m_has_more_pages{false};
 
     /** Current page. */
-    std::vector<ignite_tuple> m_page;
+    std::shared_ptr<tuple_page> m_page;
+
+    /** Index of the next row of the current page. */
+    std::size_t m_page_row{0};
+
+    /** Mutex guarding the cursor state shared with the responses to fetch requests. */
+    std::mutex m_mutex;
+
+    /** Maximum number of pages to fetch ahead of the consumer. */
+    std::size_t m_prefetch_depth{0};
+
+    /** Maximum total size of prefetched pages. */
+    std::size_t m_prefetch_max_bytes{0};
+
+    /** Prefetched pages. */
+    std::deque<std::shared_ptr<tuple_page>> m_prefetched;
+
+    /** Total size of prefetched pages. */
+    std::size_t m_prefetched_bytes{0};
+
+    /** Whether a fetch request is in flight. */
+    bool m_fetching{false};
+
+    /** Whether the cursor is being closed. */
+    bool m_closing{false};
+
+    /** Callback of the consumer waiting for the in-flight fetch request. */
+    std::function<void(ignite_result<void>)> m_fetch_callback;
+
+    /** Error of a prefetch request, reported on the next fetch. */
+    std::optional<ignite_error> m_fetch_error;
+
+    /** Page size advisor. */
+    std::shared_ptr<page_size_advisor> m_advisor;
+
+    /** Query text. */
+    std::string m_query;
+
+    /** Statistics of the received pages. */
+    result_set_statistics m_statistics;
 };
 
 } // namespace ignite::detail
@@ -22,47 +22,60 @@
 
 #include <ignite/tuple/binary_tuple_builder.h>
 
-namespace ignite::detail {
-
-void sql_impl::execute_async(transaction *tx, const sql_statement &statement, std::vector<primitive> &&args,
-    ignite_callback<result_set> &&callback) {
-    auto tx0 = tx ? tx->m_impl : nullptr;
+#include <string>
+#include <vector>
 
-    auto writer_func = [&statement, &args, &tx0](protocol::writer &writer) {
-        if (tx0)
-            writer.write(tx0->get_id());
-        else
-            writer.write_nil();
+namespace ignite::detail {
 
-        writer.write(statement.schema());
-        writer.write(statement.page_size());
-        writer.write(std::int64_t(statement.timeout().count()));
-        writer.write_nil(); // Session timeout (unused, session is closed by the server immediately).
+/**
+ * Write statement properties.
+ *
+ * @param writer Writer.
+ * @param statement Statement.
+ */
+void write_properties(protocol::writer &writer, const sql_statement &statement) {
+    const auto &properties = statement.properties();
+    auto props_num = std::int32_t(properties.size());
 
-        const auto &properties = statement.properties();
-        auto props_num = std::int32_t(properties.size());
+    writer.write(props_num);
 
-        writer.write(props_num);
+    binary_tuple_builder prop_builder{props_num * 4};
 
-        binary_tuple_builder prop_builder{props_num * 4};
+    prop_builder.start_single_pass();
+    for (const auto &property : properties) {
+        prop_builder.append_string(property.first);
+        append_primitive_with_type(prop_builder, property.second);
+    }
 
-        prop_builder.start();
-        for (const auto &property : properties) {
-            prop_builder.claim_string(property.first);
-            claim_primitive_with_type(prop_builder, property.second);
-        }
-
-        prop_builder.layout();
-        for (const auto &property : properties) {
-            prop_builder.append_string(property.first);
-            append_primitive_with_type(prop_builder, property.second);
-        }
+    prop_builder.build(writer.reserve_binary(prop_builder.get_tuple_size()));
+}
 
-        auto prop_data = prop_builder.build();
-        writer.write_binary(prop_data);
+/**
+ * Encode the parts of the statement which define its result.
+ *
+ * @param statement Statement.
+ * @param args_writer Function writing the arguments for the statement.
+ * @return Result cache key.
+ */
+std::string make_result_cache_key(
+    const sql_statement &statement, const std::function<void(protocol::writer &)> &args_writer) {
+    std::vector<std::byte> data;
+    {
+        protocol::buffer_adapter buffer(data);
+        protocol::writer writer(buffer);
 
+        writer.write(statement.schema());
+        write_properties(writer, statement);
         writer.write(statement.query());
+        args_writer(writer);
+    }
+
+    return {reinterpret_cast<const char *>(data.data()), data.size()};
+}
 
+void sql_impl::execute_async(transaction *tx, const sql_statement &statement, std::vector<primitive> &&args,
+    ignite_callback<result_set> &&callback) {
+    auto args_writer = [&args](protocol::writer &writer) {
         if (args.empty()) {
             writer.write_nil();
             return;
@@ -74,22 +87,95 @@ void sql_impl::execute_async(transaction *tx, const sql_statement &statement, st
 
         binary_tuple_builder args_builder{args_num * 3};
 
-        args_builder.start();
+        args_builder.start_single_pass();
         for (const auto &arg : args) {
-            claim_primitive_with_type(args_builder, arg);
+            append_primitive_with_type(args_builder, arg);
         }
 
-        args_builder.layout();
-        for (const auto &arg : args) {
-            append_primitive_with_type(args_builder, arg);
+        args_builder.build(writer.reserve_binary(args_builder.get_tuple_size()));
+    };
+
+    execute_with_args_async(tx, statement, args_writer, std::move(callback));
+}
+
+void sql_impl::execute_async(transaction *tx, const sql_statement &statement, const typed_arguments &args,
+    ignite_callback<result_set> &&callback) {
+    auto args_writer = [&args](protocol::writer &writer) {
+        if (!args.count) {
+            writer.write_nil();
+            return;
         }
 
-        auto args_data = args_builder.build();
-        writer.write_binary(args_data);
+        writer.write(args.count);
+        write_typed_arguments(writer, args);
     };
 
-    auto reader_func = [](std::shared_ptr<node_connection> channel, bytes_view msg) -> result_set {
-        return result_set{std::make_shared<result_set_impl>(std::move(channel), msg)};
+    execute_with_args_async(tx, statement, args_writer, std::move(callback));
+}
+
+void sql_impl::execute_with_args_async(transaction *tx, const sql_statement &statement,
+    const std::function<void(protocol::writer &)> &args_writer, ignite_callback<result_set> &&callback) {
+    auto tx0 = tx ? tx->m_impl : nullptr;
+
+    // Transactional queries must see the state of the transaction, so only their side effects are tracked.
+    auto cache = get_result_cache();
+    std::string cache_key;
+    std::uint64_t generation{0};
+    if (cache && !tx0) {
+        cache_key = make_result_cache_key(statement, args_writer);
+        auto cached = cache->get(cache_key);
+        if (cached) {
+            callback({result_set{std::make_shared<result_set_impl>(nullptr, *cached)}});
+            return;
+        }
+        generation = cache->get_generation();
+    }
+
+    auto page_size = m_page_size_advisor->page_size(statement);
+
+    auto writer_func = [&statement, &args_writer, &tx0, page_size](protocol::writer &writer) {
+        if (tx0)
+            tx0->write_id(writer);
+        else
+            writer.write_nil();
+
+        writer.write(statement.schema());
+        writer.write(page_size);
+        writer.write(std::int64_t(statement.timeout().count()));
+        writer.write_nil(); // Session timeout (unused, session is closed by the server immediately).
+
+        write_properties(writer, statement);
+
+        writer.write(statement.query());
+        args_writer(writer);
+    };
+
+    // Only the queries that target a page size in bytes contribute to the row size estimates.
+    auto advisor = statement.target_page_bytes() ? m_page_size_advisor : nullptr;
+
+    auto reader_func = [prefetch_depth = statement.prefetch_depth(),
+                           prefetch_max_bytes = statement.prefetch_max_bytes(), page_size, advisor = std::move(advisor),
+                           query = statement.query(), cache = std::move(cache), cache_key = std::move(cache_key),
+                           generation, tx0](std::shared_ptr<node_connection> channel, bytes_view msg) -> result_set {
+        auto impl = std::make_shared<result_set_impl>(
+            std::move(channel), msg, prefetch_depth, prefetch_max_bytes, page_size, advisor, query);
+
+        if (cache) {
+            // Statements without a row set may change the data, so all the cached results are dropped. Changes made in
+            // a transaction are only visible once it is finished, so they are dropped on commit or rollback instead.
+            if (!impl->has_rowset()) {
+                if (tx0)
+                    tx0->add_finish_hook([cache] { cache->invalidate(); });
+                else
+                    cache->invalidate();
+            } else if (!cache_key.empty() && impl->is_complete()) {
+                cache->put(cache_key, msg, generation);
+            }
+        }
+
+        impl->start_prefetch();
+
+        return result_set{std::move(impl)};
     };
 
     m_connection->perform_request_raw<result_set>(
@@ -18,12 +18,18 @@
 #pragma once
 
 #include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/sql/page_size_advisor.h"
+#include "ignite/client/detail/sql/sql_result_cache.h"
+#include "ignite/client/detail/typed_arguments.h"
 #include "ignite/client/primitive.h"
 #include "ignite/client/sql/result_set.h"
+#include "ignite/client/sql/sql_result_cache_options.h"
 #include "ignite/client/sql/sql_statement.h"
 #include "ignite/client/transaction/transaction.h"
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace ignite::detail {
@@ -48,7 +54,8 @@ public:
      * @param connection Connection.
      */
     explicit sql_impl(std::shared_ptr<cluster_connection> connection)
-        : m_connection(std::move(connection)) {}
+        : m_connection(std::move(connection))
+        , m_page_size_advisor(std::make_shared<page_size_advisor>()) {}
 
     /**
      * Executes single SQL statement and returns rows.
@@ -62,9 +69,81 @@ public:
     void execute_async(transaction *tx, const sql_statement &statement, std::vector<primitive> &&args,
         ignite_callback<result_set> &&callback);
 
+    /**
+     * Executes single SQL statement with encoded arguments and returns rows.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param statement statement to execute.
+     * @param args Typed arguments for the statement.
+     * @param callback A callback called on operation completion with SQL result set.
+     */
+    void execute_async(transaction *tx, const sql_statement &statement, const typed_arguments &args,
+        ignite_callback<result_set> &&callback);
+
+    /**
+     * Enable the result cache, replacing the current one if any.
+     *
+     * @param options Result cache options.
+     */
+    void enable_result_cache(const sql_result_cache_options &options) {
+        auto cache = std::make_shared<sql_result_cache>(options);
+
+        std::lock_guard<std::mutex> lock(m_result_cache_mutex);
+        m_result_cache = std::move(cache);
+    }
+
+    /**
+     * Disable the result cache.
+     */
+    void disable_result_cache() {
+        std::lock_guard<std::mutex> lock(m_result_cache_mutex);
+        m_result_cache.reset();
+    }
+
+    /**
+     * Drop all the cached results.
+     */
+    void invalidate_result_cache() {
+        auto cache = get_result_cache();
+        if (cache)
+            cache->invalidate();
+    }
+
 private:
+    /**
+     * Get the result cache.
+     *
+     * @return Result cache or @c nullptr if it is disabled.
+     */
+    [[nodiscard]] std::shared_ptr<sql_result_cache> get_result_cache() const {
+        std::lock_guard<std::mutex> lock(m_result_cache_mutex);
+        return m_result_cache;
+    }
+
+    /**
+     * Executes single SQL statement and returns rows.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param statement statement to execute.
+     * @param args_writer Function writing the arguments for the statement.
+     * @param callback A callback called on operation completion with SQL result set.
+     */
+    void execute_with_args_async(transaction *tx, const sql_statement &statement,
+        const std::function<void(protocol::writer &)> &args_writer, ignite_callback<result_set> &&callback);
+
     /** Cluster connection. */
     std::shared_ptr<cluster_connection> m_connection;
+
+    /** Page size advisor. */
+    std::shared_ptr<page_size_advisor> m_page_size_advisor;
+
+    /** Result cache mutex. */
+    mutable std::mutex m_result_cache_mutex;
+
+    /** Result cache. */
+    std::shared_ptr<sql_result_cache> m_result_cache;
 };
 
 } // namespace ignite::detail
@@ -0,0 +1,180 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/sql/sql_result_cache_options.h"
+
+#include "ignite/common/bytes_view.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Cache of SQL results.
+ *
+ * Results are stored as the encoded responses to the query execution requests, keyed by the encoded schema,
+ * properties, query text and arguments. A response is decoded again on every hit.
+ */
+class sql_result_cache {
+public:
+    /**
+     * Constructor.
+     *
+     * @param options Options.
+     */
+    explicit sql_result_cache(const sql_result_cache_options &options)
+        : m_options(options) {}
+
+    /**
+     * Get a result.
+     *
+     * @param key Encoded query.
+     * @return Encoded response or @c nullptr if the result is not cached.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<std::byte>> get(const std::string &key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return nullptr;
+
+        auto entry_it = it->second;
+        if (entry_it->expires <= std::chrono::steady_clock::now()) {
+            remove(entry_it);
+            return nullptr;
+        }
+
+        m_entries.splice(m_entries.begin(), m_entries, entry_it);
+
+        return entry_it->response;
+    }
+
+    /**
+     * Get the current generation. It changes on every invalidation, so a result which was received concurrently
+     * with an invalidation is not cached.
+     *
+     * @return Generation.
+     */
+    [[nodiscard]] std::uint64_t get_generation() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_generation;
+    }
+
+    /**
+     * Put a result.
+     *
+     * @param key Encoded query.
+     * @param response Encoded response.
+     * @param generation Generation obtained before the query was sent.
+     */
+    void put(const std::string &key, bytes_view response, std::uint64_t generation) {
+        auto size = key.size() + response.size();
+        if (size > m_options.max_entry_size_bytes() || size > m_options.max_size_bytes())
+            return;
+
+        auto data = std::make_shared<const std::vector<std::byte>>(response.begin(), response.end());
+        auto expires = std::chrono::steady_clock::now() + m_options.ttl();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (generation != m_generation)
+            return;
+
+        auto it = m_index.find(key);
+        if (it != m_index.end())
+            remove(it->second);
+
+        m_entries.push_front({key, std::move(data), expires});
+        m_index.emplace(m_entries.front().key, m_entries.begin());
+        m_size += size;
+
+        while (m_size > m_options.max_size_bytes())
+            remove(std::prev(m_entries.end()));
+    }
+
+    /**
+     * Drop all the results.
+     */
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        ++m_generation;
+        m_index.clear();
+        m_entries.clear();
+        m_size = 0;
+    }
+
+private:
+    /**
+     * Cache entry.
+     */
+    struct entry {
+        /** Encoded query. */
+        std::string key;
+
+        /** Encoded response. */
+        std::shared_ptr<const std::vector<std::byte>> response;
+
+        /** Expiration time. */
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    /** Entry list type. */
+    typedef std::list<entry> entry_list;
+
+    /**
+     * Remove an entry. Should be called with the mutex held.
+     *
+     * @param it Entry.
+     */
+    void remove(entry_list::iterator it) {
+        m_size -= it->key.size() + it->response->size();
+        m_index.erase(it->key);
+        m_entries.erase(it);
+    }
+
+    /** Options. */
+    const sql_result_cache_options m_options;
+
+    /** Mutex. */
+    mutable std::mutex m_mutex;
+
+    /** Entries, from the most to the least recently used one. */
+    entry_list m_entries;
+
+    /** Entries by key. Keys reference the keys stored in the entries. */
+    std::unordered_map<std::string_view, entry_list::iterator> m_index;
+
+    /** Total size of the cached keys and responses. */
+    std::size_t m_size{0};
+
+    /** Generation. */
+    std::uint64_t m_generation{0};
+};
+
+} // namespace ignite::detail
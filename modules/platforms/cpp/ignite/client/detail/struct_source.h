@@ -0,0 +1,512 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/client/detail/tuple_writer.h>
+#include <ignite/client/primitive.h>
+#include <ignite/client/struct_mapping.h>
+#include <ignite/client/table/ignite_tuple.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Check whether the type is @c std::optional.
+ */
+template<typename T>
+struct is_optional : std::false_type {};
+
+template<typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+/**
+ * Get the value type of @c std::optional, or the type itself.
+ */
+template<typename T>
+struct remove_optional {
+    typedef T type;
+};
+
+template<typename T>
+struct remove_optional<std::optional<T>> {
+    typedef T type;
+};
+
+/**
+ * Get the column type corresponding to the member type.
+ *
+ * @tparam T Member type.
+ * @return Column type.
+ */
+template<typename T>
+constexpr ignite_type column_type_of() {
+    typedef typename remove_optional<T>::type V;
+
+    if constexpr (std::is_same_v<V, bool>)
+        return ignite_type::BOOLEAN;
+    else if constexpr (std::is_same_v<V, std::int8_t>)
+        return ignite_type::INT8;
+    else if constexpr (std::is_same_v<V, std::int16_t>)
+        return ignite_type::INT16;
+    else if constexpr (std::is_same_v<V, std::int32_t>)
+        return ignite_type::INT32;
+    else if constexpr (std::is_same_v<V, std::int64_t>)
+        return ignite_type::INT64;
+    else if constexpr (std::is_same_v<V, float>)
+        return ignite_type::FLOAT;
+    else if constexpr (std::is_same_v<V, double>)
+        return ignite_type::DOUBLE;
+    else if constexpr (std::is_same_v<V, uuid>)
+        return ignite_type::UUID;
+    else if constexpr (std::is_same_v<V, std::string>)
+        return ignite_type::STRING;
+    else if constexpr (std::is_same_v<V, std::vector<std::byte>>)
+        return ignite_type::BYTE_ARRAY;
+    else if constexpr (std::is_same_v<V, big_decimal>)
+        return ignite_type::DECIMAL;
+    else if constexpr (std::is_same_v<V, big_integer>)
+        return ignite_type::NUMBER;
+    else if constexpr (std::is_same_v<V, ignite_date>)
+        return ignite_type::DATE;
+    else if constexpr (std::is_same_v<V, ignite_time>)
+        return ignite_type::TIME;
+    else if constexpr (std::is_same_v<V, ignite_date_time>)
+        return ignite_type::DATETIME;
+    else if constexpr (std::is_same_v<V, ignite_timestamp>)
+        return ignite_type::TIMESTAMP;
+    else if constexpr (std::is_same_v<V, ignite_period>)
+        return ignite_type::PERIOD;
+    else if constexpr (std::is_same_v<V, ignite_duration>)
+        return ignite_type::DURATION;
+    else if constexpr (std::is_same_v<V, bit_array>)
+        return ignite_type::BITMASK;
+    else
+        static_assert(sizeof(V) == 0, "Member type is not supported by the struct mapping");
+}
+
+/**
+ * Append the member value in tuple writer.
+ *
+ * @param writer Tuple writer.
+ * @param value Value.
+ * @param scale Column scale.
+ */
+template<typename T>
+void append_member(tuple_writer &writer, const T &value, std::int32_t scale) {
+    if constexpr (is_optional<T>::value) {
+        if (value)
+            append_member(writer, *value, scale);
+        else
+            writer.append_null();
+    } else if constexpr (std::is_same_v<T, bool>)
+        writer.append_bool(value);
+    else if constexpr (std::is_same_v<T, std::int8_t>)
+        writer.append_int8(value);
+    else if constexpr (std::is_same_v<T, std::int16_t>)
+        writer.append_int16(value);
+    else if constexpr (std::is_same_v<T, std::int32_t>)
+        writer.append_int32(value);
+    else if constexpr (std::is_same_v<T, std::int64_t>)
+        writer.append_int64(value);
+    else if constexpr (std::is_same_v<T, float>)
+        writer.append_float(value);
+    else if constexpr (std::is_same_v<T, double>)
+        writer.append_double(value);
+    else if constexpr (std::is_same_v<T, uuid>)
+        writer.append_uuid(value);
+    else if constexpr (std::is_same_v<T, std::string>)
+        writer.append_string(value);
+    else if constexpr (std::is_same_v<T, std::vector<std::byte>>)
+        writer.append_bytes(value);
+    else if constexpr (std::is_same_v<T, big_decimal>)
+        writer.append_decimal(value, scale);
+    else if constexpr (std::is_same_v<T, big_integer>)
+        writer.append_number(value);
+    else if constexpr (std::is_same_v<T, ignite_date>)
+        writer.append_date(value);
+    else if constexpr (std::is_same_v<T, ignite_time>)
+        writer.append_time(value);
+    else if constexpr (std::is_same_v<T, ignite_date_time>)
+        writer.append_date_time(value);
+    else if constexpr (std::is_same_v<T, ignite_timestamp>)
+        writer.append_timestamp(value);
+    else if constexpr (std::is_same_v<T, ignite_period>)
+        writer.append_period(value);
+    else if constexpr (std::is_same_v<T, ignite_duration>)
+        writer.append_duration(value);
+    else if constexpr (std::is_same_v<T, bit_array>)
+        writer.append_bit_array(value);
+    else
+        static_assert(sizeof(T) == 0, "Member type is not supported by the struct mapping");
+}
+
+/**
+ * Tuple source which holds values of a mapped user type.
+ *
+ * Tuples backed by this source are serialized straight from the user values by the generated per-field encoders.
+ * It also provides the decoder for the opposite direction.
+ *
+ * @tparam T Mapped user type.
+ */
+template<typename T>
+class struct_source final : public tuple_source {
+public:
+    /** Number of mapped fields. */
+    static constexpr std::size_t FIELDS_NUM = std::tuple_size_v<decltype(struct_mapping<T>::fields())>;
+
+    /**
+     * Decoder of tuples into values. Column ordinals are resolved once per tuple source, so decoding rows of a
+     * single response does not involve any name lookups.
+     */
+    class decoder {
+    public:
+        /**
+         * Decode the value.
+         *
+         * @param tuple Tuple.
+         * @return Value.
+         */
+        [[nodiscard]] T decode(const ignite_tuple &tuple) {
+            auto [source, row] = get_source(tuple);
+            if (!source)
+                return decode_detached(tuple, std::make_index_sequence<FIELDS_NUM>{});
+
+            if (source != m_source) {
+                for (std::size_t i = 0; i < FIELDS_NUM; ++i)
+                    m_ordinals[i] = source->column_ordinal(parsed_names()[i]);
+
+                m_source = source;
+            }
+
+            return decode_source(*source, row, std::make_index_sequence<FIELDS_NUM>{});
+        }
+
+    private:
+        /**
+         * Decode the value from the source.
+         */
+        template<std::size_t... I>
+        T decode_source(const tuple_source &source, std::size_t row, std::index_sequence<I...>) const {
+            T res{};
+            (decode_field<I>(source, row, m_ordinals[I], res), ...);
+            return res;
+        }
+
+        /**
+         * Decode the value from the tuple which is not backed by a source.
+         */
+        template<std::size_t... I>
+        static T decode_detached(const ignite_tuple &tuple, std::index_sequence<I...>) {
+            T res{};
+            (assign_field<I>(tuple, tuple.column_ordinal(names()[I]), res), ...);
+            return res;
+        }
+
+        /** Last used source. */
+        const tuple_source *m_source{nullptr};
+
+        /** Column ordinals in the last used source. */
+        std::array<std::int32_t, FIELDS_NUM> m_ordinals{};
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param values Values.
+     */
+    explicit struct_source(std::vector<T> values)
+        : m_values(std::move(values)) {}
+
+    /**
+     * Constructor of the source with a single value.
+     *
+     * @param value Value.
+     */
+    explicit struct_source(T value)
+        : m_value(std::move(value)) {}
+
+    /**
+     * Make a tuple backed by the value. The value is stored inline in the source, so only a single allocation is
+     * made.
+     *
+     * @param value Value.
+     * @return Tuple.
+     */
+    [[nodiscard]] static ignite_tuple to_tuple(T value) {
+        return make_tuple(std::make_shared<struct_source>(std::move(value)), 0);
+    }
+
+    /**
+     * Make tuples backed by the values. All the tuples share a single source.
+     *
+     * @param values Values.
+     * @return Tuples.
+     */
+    [[nodiscard]] static std::vector<ignite_tuple> to_tuples(std::vector<T> values) {
+        auto count = values.size();
+        auto source = std::make_shared<struct_source>(std::move(values));
+
+        std::vector<ignite_tuple> tuples;
+        tuples.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            tuples.push_back(make_tuple(source, i));
+
+        return tuples;
+    }
+
+    [[nodiscard]] std::size_t row_count() const override { return m_value ? 1 : m_values.size(); }
+
+    [[nodiscard]] std::int32_t column_count() const override { return std::int32_t(FIELDS_NUM); }
+
+    [[nodiscard]] const std::string &column_name(std::int32_t idx) const override { return names()[idx]; }
+
+    [[nodiscard]] ignite_type column_type(std::int32_t idx) const override { return types()[idx]; }
+
+    [[nodiscard]] std::int32_t column_ordinal(const std::string &parsed_name) const override {
+        for (std::size_t i = 0; i < FIELDS_NUM; ++i) {
+            if (parsed_names()[i] == parsed_name)
+                return std::int32_t(i);
+        }
+        return -1;
+    }
+
+    [[nodiscard]] primitive get(std::size_t row, std::int32_t idx) const override {
+        static const auto getters = make_getters(std::make_index_sequence<FIELDS_NUM>{});
+        return getters[idx](value(row));
+    }
+
+    [[nodiscard]] std::optional<bytes_view> get_raw(std::size_t row, std::int32_t idx) const override {
+        static const auto getters = make_raw_getters(std::make_index_sequence<FIELDS_NUM>{});
+        return getters[idx](value(row));
+    }
+
+    [[nodiscard]] const encoder *encoders() const override {
+        static const auto encoders = make_encoders(std::make_index_sequence<FIELDS_NUM>{});
+        return encoders.data();
+    }
+
+private:
+    /**
+     * Get the mapped field.
+     */
+    template<std::size_t I>
+    static constexpr auto field() {
+        return std::get<I>(struct_mapping<T>::fields());
+    }
+
+    /**
+     * Get the member type of the field.
+     */
+    template<std::size_t I>
+    using member_type = typename decltype(field<I>())::type;
+
+    /**
+     * Get field names.
+     */
+    static const std::array<std::string, FIELDS_NUM> &names() {
+        static const auto names = make_names(std::make_index_sequence<FIELDS_NUM>{});
+        return names;
+    }
+
+    /**
+     * Get normalized field names.
+     */
+    static const std::array<std::string, FIELDS_NUM> &parsed_names() {
+        static const auto parsed_names = make_parsed_names(std::make_index_sequence<FIELDS_NUM>{});
+        return parsed_names;
+    }
+
+    /**
+     * Get column types of the fields.
+     */
+    static const std::array<ignite_type, FIELDS_NUM> &types() {
+        static const std::array<ignite_type, FIELDS_NUM> types =
+            make_types(std::make_index_sequence<FIELDS_NUM>{});
+        return types;
+    }
+
+    template<std::size_t... I>
+    static std::array<std::string, FIELDS_NUM> make_names(std::index_sequence<I...>) {
+        return {std::string(field<I>().name)...};
+    }
+
+    template<std::size_t... I>
+    static std::array<std::string, FIELDS_NUM> make_parsed_names(std::index_sequence<I...>) {
+        return {parse_name(field<I>().name)...};
+    }
+
+    template<std::size_t... I>
+    static constexpr std::array<ignite_type, FIELDS_NUM> make_types(std::index_sequence<I...>) {
+        return {column_type_of<member_type<I>>()...};
+    }
+
+    template<std::size_t... I>
+    static std::array<primitive (*)(const T &), FIELDS_NUM> make_getters(std::index_sequence<I...>) {
+        return {&get_field<I>...};
+    }
+
+    template<std::size_t... I>
+    static std::array<std::optional<bytes_view> (*)(const T &), FIELDS_NUM> make_raw_getters(
+        std::index_sequence<I...>) {
+        return {&get_field_raw<I>...};
+    }
+
+    template<std::size_t... I>
+    static std::array<encoder, FIELDS_NUM> make_encoders(std::index_sequence<I...>) {
+        return {&append_field<I>...};
+    }
+
+    /**
+     * Get the field value as a primitive.
+     */
+    template<std::size_t I>
+    static primitive get_field(const T &value) {
+        const auto &member = value.*(field<I>().member);
+        if constexpr (is_optional<member_type<I>>::value) {
+            if (!member)
+                return {};
+
+            return {*member};
+        } else
+            return {member};
+    }
+
+    /**
+     * Get the string or byte array field value as bytes.
+     */
+    template<std::size_t I>
+    static std::optional<bytes_view> get_field_raw(const T &value) {
+        typedef typename remove_optional<member_type<I>>::type V;
+
+        if constexpr (std::is_same_v<V, std::string> || std::is_same_v<V, std::vector<std::byte>>) {
+            const auto &member = value.*(field<I>().member);
+            if constexpr (is_optional<member_type<I>>::value) {
+                if (!member)
+                    return std::nullopt;
+
+                return bytes_view{member->data(), member->size()};
+            } else
+                return bytes_view{member.data(), member.size()};
+        } else
+            return std::nullopt;
+    }
+
+    /**
+     * Append the field value.
+     */
+    template<std::size_t I>
+    static void append_field(tuple_writer &writer, const tuple_source &source, std::size_t row, std::int32_t scale) {
+        const auto &value = static_cast<const struct_source &>(source).value(row);
+        append_member(writer, value.*(field<I>().member), scale);
+    }
+
+    /**
+     * Decode the field from the source. Fields without the corresponding column are left as is.
+     */
+    template<std::size_t I>
+    static void decode_field(const tuple_source &source, std::size_t row, std::int32_t idx, T &res) {
+        if (idx < 0)
+            return;
+
+        typedef typename remove_optional<member_type<I>>::type V;
+        auto &member = res.*(field<I>().member);
+
+        if (source.column_type(idx) != column_type_of<V>())
+            throw ignite_error("Column type mismatch for the field '" + names()[I] + "'");
+
+        if constexpr (std::is_same_v<V, std::string> || std::is_same_v<V, std::vector<std::byte>>) {
+            // Strings and byte arrays are constructed straight from the received data.
+            auto raw = source.get_raw(row, idx);
+            if (!raw) {
+                set_null<I>(member);
+                return;
+            }
+
+            if constexpr (std::is_same_v<V, std::string>)
+                member = std::string(reinterpret_cast<const char *>(raw->data()), raw->size());
+            else
+                member = std::vector<std::byte>(raw->begin(), raw->end());
+        } else {
+            assign_value<I>(source.get(row, idx), member);
+        }
+    }
+
+    /**
+     * Assign the field from the tuple which is not backed by a source.
+     */
+    template<std::size_t I>
+    static void assign_field(const ignite_tuple &tuple, std::int32_t idx, T &res) {
+        if (idx < 0)
+            return;
+
+        typedef typename remove_optional<member_type<I>>::type V;
+        const auto &value = tuple.get(std::uint32_t(idx));
+        if (!value.is_null() && value.get_type() != column_type_of<V>())
+            throw ignite_error("Column type mismatch for the field '" + names()[I] + "'");
+
+        assign_value<I>(value, res.*(field<I>().member));
+    }
+
+    /**
+     * Assign the member from the primitive value.
+     */
+    template<std::size_t I, typename M>
+    static void assign_value(const primitive &value, M &member) {
+        if (value.is_null()) {
+            set_null<I>(member);
+            return;
+        }
+
+        member = value.get<typename remove_optional<M>::type>();
+    }
+
+    /**
+     * Set the member to null, if it is nullable.
+     */
+    template<std::size_t I, typename M>
+    static void set_null(M &member) {
+        if constexpr (is_optional<M>::value)
+            member = std::nullopt;
+        else
+            throw ignite_error("Column value is null for the non-nullable field '" + names()[I] + "'");
+    }
+
+    /**
+     * Get the value of the row.
+     *
+     * @param row The row index.
+     * @return Value.
+     */
+    [[nodiscard]] const T &value(std::size_t row) const { return m_value ? *m_value : m_values[row]; }
+
+    /** Single value of the source, stored inline. */
+    const std::optional<T> m_value;
+
+    /** Values. */
+    const std::vector<T> m_values;
+};
+
+} // namespace ignite::detail
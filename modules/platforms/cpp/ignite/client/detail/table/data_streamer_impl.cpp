@@ -0,0 +1,330 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/table/data_streamer_impl.h"
+
+#include <string>
+
+namespace ignite::detail {
+
+std::shared_ptr<data_streamer_impl> data_streamer_impl::create(
+    std::shared_ptr<table_impl> table, data_streamer_options options) {
+    if (options.page_size() <= 0)
+        throw ignite_error("Page size is not positive: " + std::to_string(options.page_size()));
+
+    if (options.parallel_operations() <= 0)
+        throw ignite_error(
+            "Parallel operations number is not positive: " + std::to_string(options.parallel_operations()));
+
+    if (options.max_pending_rows() == 0)
+        throw ignite_error("Max pending rows number is zero");
+
+    std::shared_ptr<data_streamer_impl> res{new data_streamer_impl(std::move(table), std::move(options))};
+
+    if (res->m_options.auto_flush_interval().count() > 0)
+        res->m_thread = std::thread(auto_flush_routine, std::weak_ptr<data_streamer_impl>(res));
+
+    return res;
+}
+
+data_streamer_impl::~data_streamer_impl() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+    m_cond.notify_all();
+
+    if (m_thread.joinable()) {
+        // The last reference can be released by the auto flush thread itself.
+        if (m_thread.get_id() == std::this_thread::get_id())
+            m_thread.detach();
+        else
+            m_thread.join();
+    }
+}
+
+void data_streamer_impl::add(ignite_tuple record) {
+    std::vector<std::shared_ptr<batch>> batches;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        wait_for_space(lock);
+
+        m_current->records->push_back(std::move(record));
+        batches = on_row_added();
+    }
+
+    send(batches);
+}
+
+void data_streamer_impl::add(ignite_tuple key, ignite_tuple value) {
+    std::vector<std::shared_ptr<batch>> batches;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        wait_for_space(lock);
+
+        m_current->pairs->emplace_back(std::move(key), std::move(value));
+        batches = on_row_added();
+    }
+
+    send(batches);
+}
+
+void data_streamer_impl::flush_async(ignite_callback<void> callback) {
+    std::vector<std::shared_ptr<batch>> batches;
+    std::optional<ignite_result<void>> res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        queue_current();
+        batches = take_sendable();
+
+        auto seq = m_next_seq - 1;
+        if (m_outstanding.empty() || *m_outstanding.begin() > seq)
+            res = flush_result();
+        else
+            m_waiters.push_back({seq, std::move(callback)});
+    }
+
+    send(batches);
+
+    if (res)
+        callback(std::move(*res));
+}
+
+void data_streamer_impl::close_async(ignite_callback<void> callback) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+    m_cond.notify_all();
+
+    flush_async(std::move(callback));
+}
+
+data_streamer_progress data_streamer_impl::get_progress() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_progress;
+}
+
+void data_streamer_impl::wait_for_space(std::unique_lock<std::mutex> &lock) {
+    m_cond.wait(lock, [this] { return m_closed || m_error || m_pending_rows < m_options.max_pending_rows(); });
+
+    if (m_closed)
+        throw ignite_error("Data streamer is closed");
+
+    if (m_error)
+        throw ignite_error(*m_error);
+}
+
+std::vector<std::shared_ptr<data_streamer_impl::batch>> data_streamer_impl::on_row_added() {
+    if (m_current->size() == 1)
+        m_current_started = std::chrono::steady_clock::now();
+
+    ++m_pending_rows;
+    ++m_progress.rows_added;
+
+    // Queue the batch when it is full or when it holds all the rows we can accept, so add() never waits for rows
+    // which are not being sent.
+    if (m_current->size() >= std::size_t(m_options.page_size()) || m_pending_rows >= m_options.max_pending_rows())
+        queue_current();
+
+    return take_sendable();
+}
+
+void data_streamer_impl::queue_current() {
+    if (m_current->size() == 0)
+        return;
+
+    m_current->seq = m_next_seq++;
+    m_outstanding.insert(m_current->seq);
+    m_queue.push_back(std::move(m_current));
+    m_current = std::make_shared<batch>();
+}
+
+std::vector<std::shared_ptr<data_streamer_impl::batch>> data_streamer_impl::take_sendable() {
+    std::vector<std::shared_ptr<batch>> res;
+    while (!m_queue.empty() && m_in_flight < m_options.parallel_operations()) {
+        ++m_in_flight;
+        res.push_back(std::move(m_queue.front()));
+        m_queue.pop_front();
+    }
+
+    return res;
+}
+
+std::vector<ignite_callback<void>> data_streamer_impl::take_completed_waiters() {
+    std::vector<ignite_callback<void>> res;
+    auto it = m_waiters.begin();
+    while (it != m_waiters.end()) {
+        if (m_outstanding.empty() || *m_outstanding.begin() > it->seq) {
+            res.push_back(std::move(it->callback));
+            it = m_waiters.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return res;
+}
+
+ignite_result<void> data_streamer_impl::flush_result() const {
+    if (m_error)
+        return {ignite_error(*m_error)};
+
+    return {};
+}
+
+void data_streamer_impl::send(const std::vector<std::shared_ptr<batch>> &batches) {
+    for (const auto &bt : batches)
+        send(bt);
+}
+
+void data_streamer_impl::send(const std::shared_ptr<batch> &bt) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        bt->error.reset();
+        bt->parts_in_flight = std::int32_t(!bt->records->empty()) + std::int32_t(!bt->pairs->empty());
+    }
+
+    auto callback = [self = shared_from_this(), bt](ignite_result<void> &&res) {
+        self->on_part_done(bt, std::move(res));
+    };
+
+    // Each part goes over a random connection, so the batches are spread across the cluster.
+    if (!bt->records->empty()) {
+        try {
+            m_table->upsert_all_async(nullptr, bt->records, callback);
+        } catch (ignite_error &err) {
+            callback({std::move(err)});
+        }
+    }
+
+    if (!bt->pairs->empty()) {
+        try {
+            m_table->put_all_async(nullptr, bt->pairs, callback);
+        } catch (ignite_error &err) {
+            callback({std::move(err)});
+        }
+    }
+}
+
+void data_streamer_impl::on_part_done(const std::shared_ptr<batch> &bt, ignite_result<void> &&res) {
+    bool retry = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (res.has_error() && !bt->error)
+            bt->error = std::move(res).error();
+
+        if (--bt->parts_in_flight > 0)
+            return;
+
+        if (bt->error && bt->retries < m_options.retry_limit()) {
+            ++bt->retries;
+            ++m_progress.batches_retried;
+            retry = true;
+        }
+    }
+
+    // Upserts are idempotent, so the whole batch is sent again even if one of its parts succeeded.
+    if (retry) {
+        send(bt);
+        return;
+    }
+
+    on_batch_done(bt);
+}
+
+void data_streamer_impl::on_batch_done(const std::shared_ptr<batch> &bt) {
+    std::vector<std::shared_ptr<batch>> batches;
+    data_streamer_progress progress;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        --m_in_flight;
+        m_pending_rows -= bt->size();
+
+        if (bt->error) {
+            m_progress.rows_failed += bt->size();
+            if (!m_error)
+                m_error = bt->error;
+        } else {
+            m_progress.rows_streamed += bt->size();
+            ++m_progress.batches_streamed;
+        }
+
+        batches = take_sendable();
+        progress = m_progress;
+    }
+    m_cond.notify_all();
+
+    send(batches);
+
+    if (m_options.progress_handler())
+        m_options.progress_handler()(progress);
+
+    // The batch stays outstanding until the progress is reported, so flush never completes before the handler of any
+    // batch it covers is called.
+    std::vector<ignite_callback<void>> waiters;
+    std::optional<ignite_result<void>> waiters_res;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_outstanding.erase(bt->seq);
+        waiters = take_completed_waiters();
+        if (!waiters.empty())
+            waiters_res = flush_result();
+    }
+
+    for (auto &callback : waiters) {
+        auto res = *waiters_res;
+        callback(std::move(res));
+    }
+}
+
+bool data_streamer_impl::auto_flush_step() {
+    std::vector<std::shared_ptr<batch>> batches;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto interval = m_options.auto_flush_interval();
+        auto deadline = m_current->size() ? m_current_started + interval : std::chrono::steady_clock::now() + interval;
+        m_cond.wait_until(lock, deadline, [this] { return m_closed; });
+
+        if (m_closed)
+            return false;
+
+        if (m_current->size() && std::chrono::steady_clock::now() - m_current_started >= interval)
+            queue_current();
+
+        batches = take_sendable();
+    }
+
+    send(batches);
+
+    return true;
+}
+
+void data_streamer_impl::auto_flush_routine(std::weak_ptr<data_streamer_impl> weak) {
+    while (true) {
+        auto self = weak.lock();
+        if (!self || !self->auto_flush_step())
+            return;
+    }
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,293 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/table/table_impl.h"
+#include "ignite/client/table/data_streamer_options.h"
+#include "ignite/client/table/data_streamer_progress.h"
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/ignite_result.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Data streamer implementation.
+ *
+ * Rows from all the threads are collected into a batch, which is queued once it has @c page_size rows or once it
+ * is older than the auto flush interval. Up to @c parallel_operations queued batches are written at the same time,
+ * each over a random connection, so the load is spread across the cluster.
+ */
+class data_streamer_impl : public std::enable_shared_from_this<data_streamer_impl> {
+public:
+    // Deleted
+    data_streamer_impl() = delete;
+    data_streamer_impl(data_streamer_impl &&) = delete;
+    data_streamer_impl(const data_streamer_impl &) = delete;
+    data_streamer_impl &operator=(data_streamer_impl &&) = delete;
+    data_streamer_impl &operator=(const data_streamer_impl &) = delete;
+
+    /**
+     * Create a new streamer and start its auto flush thread.
+     *
+     * @param table Table.
+     * @param options Options.
+     * @return New instance.
+     */
+    static std::shared_ptr<data_streamer_impl> create(std::shared_ptr<table_impl> table, data_streamer_options options);
+
+    /**
+     * Destructor.
+     */
+    ~data_streamer_impl();
+
+    /**
+     * Add a record.
+     *
+     * @param record Record.
+     */
+    void add(ignite_tuple record);
+
+    /**
+     * Add a record given as separate key and value tuples.
+     *
+     * @param key Key.
+     * @param value Value.
+     */
+    void add(ignite_tuple key, ignite_tuple value);
+
+    /**
+     * Send all the buffered rows and wait for the completion of the rows added so far asynchronously.
+     *
+     * @param callback Callback called with the first error of the streamer if any.
+     */
+    void flush_async(ignite_callback<void> callback);
+
+    /**
+     * Flush the streamer and stop accepting new rows asynchronously.
+     *
+     * @param callback Callback called with the first error of the streamer if any.
+     */
+    void close_async(ignite_callback<void> callback);
+
+    /**
+     * Get progress.
+     *
+     * @return Progress.
+     */
+    [[nodiscard]] data_streamer_progress get_progress() const;
+
+private:
+    /**
+     * Batch of rows.
+     */
+    struct batch {
+        /** Sequence number. */
+        std::uint64_t seq{0};
+
+        /** Records. */
+        std::shared_ptr<std::vector<ignite_tuple>> records{std::make_shared<std::vector<ignite_tuple>>()};
+
+        /** Records given as separate key and value tuples. */
+        std::shared_ptr<std::vector<std::pair<ignite_tuple, ignite_tuple>>> pairs{
+            std::make_shared<std::vector<std::pair<ignite_tuple, ignite_tuple>>>()};
+
+        /** Number of parts still being written. */
+        std::int32_t parts_in_flight{0};
+
+        /** Number of performed retries. */
+        std::int32_t retries{0};
+
+        /** Error of the current attempt. */
+        std::optional<ignite_error> error;
+
+        /**
+         * Get the number of rows.
+         *
+         * @return Number of rows.
+         */
+        [[nodiscard]] std::size_t size() const { return records->size() + pairs->size(); }
+    };
+
+    /** Flush waiter. */
+    struct flush_waiter {
+        /** Sequence number of the last batch to wait for. */
+        std::uint64_t seq;
+
+        /** Callback. */
+        ignite_callback<void> callback;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param table Table.
+     * @param options Options.
+     */
+    data_streamer_impl(std::shared_ptr<table_impl> table, data_streamer_options options)
+        : m_table(std::move(table))
+        , m_options(std::move(options)) {}
+
+    /**
+     * Wait for the space for a new row and check that the streamer can accept it. Should be called with the mutex
+     * held.
+     *
+     * @param lock Lock.
+     */
+    void wait_for_space(std::unique_lock<std::mutex> &lock);
+
+    /**
+     * Handle a row just added to the current batch. Should be called with the mutex held.
+     *
+     * @return Batches to send.
+     */
+    std::vector<std::shared_ptr<batch>> on_row_added();
+
+    /**
+     * Queue the current batch if it is not empty. Should be called with the mutex held.
+     */
+    void queue_current();
+
+    /**
+     * Take queued batches which can be sent without exceeding the parallelism. Should be called with the mutex held.
+     *
+     * @return Batches to send.
+     */
+    std::vector<std::shared_ptr<batch>> take_sendable();
+
+    /**
+     * Take flush waiters which are done. Should be called with the mutex held.
+     *
+     * @return Callbacks of the flush waiters which are done.
+     */
+    std::vector<ignite_callback<void>> take_completed_waiters();
+
+    /**
+     * Get the result to complete flush waiters with. Should be called with the mutex held.
+     *
+     * @return Result.
+     */
+    [[nodiscard]] ignite_result<void> flush_result() const;
+
+    /**
+     * Send batches.
+     *
+     * @param batches Batches.
+     */
+    void send(const std::vector<std::shared_ptr<batch>> &batches);
+
+    /**
+     * Send a batch.
+     *
+     * @param bt Batch.
+     */
+    void send(const std::shared_ptr<batch> &bt);
+
+    /**
+     * Handle a completed part of the batch.
+     *
+     * @param bt Batch.
+     * @param res Result.
+     */
+    void on_part_done(const std::shared_ptr<batch> &bt, ignite_result<void> &&res);
+
+    /**
+     * Handle a completed batch.
+     *
+     * @param bt Batch.
+     */
+    void on_batch_done(const std::shared_ptr<batch> &bt);
+
+    /**
+     * Wait for the auto flush interval and send the current batch if it is too old.
+     *
+     * @return @c false if the streamer is closed and the auto flush thread should stop.
+     */
+    bool auto_flush_step();
+
+    /**
+     * Auto flush thread routine.
+     *
+     * The thread only holds the streamer while performing a step, so it does not keep the streamer alive.
+     *
+     * @param weak Streamer.
+     */
+    static void auto_flush_routine(std::weak_ptr<data_streamer_impl> weak);
+
+    /** Table. */
+    std::shared_ptr<table_impl> m_table;
+
+    /** Options. */
+    const data_streamer_options m_options;
+
+    /** Mutex. */
+    mutable std::mutex m_mutex;
+
+    /** Condition variable to wait for space for new rows and for auto flush. */
+    std::condition_variable m_cond;
+
+    /** Current batch. */
+    std::shared_ptr<batch> m_current{std::make_shared<batch>()};
+
+    /** Time when the first row of the current batch was added. */
+    std::chrono::steady_clock::time_point m_current_started;
+
+    /** Batches waiting to be sent. */
+    std::deque<std::shared_ptr<batch>> m_queue;
+
+    /** Sequence numbers of the queued and in-flight batches, and the batches whose progress is being reported. */
+    std::set<std::uint64_t> m_outstanding;
+
+    /** Next batch sequence number. */
+    std::uint64_t m_next_seq{1};
+
+    /** Number of batches being written. */
+    std::int32_t m_in_flight{0};
+
+    /** Number of rows which are buffered or being written. */
+    std::size_t m_pending_rows{0};
+
+    /** Flush waiters. */
+    std::vector<flush_waiter> m_waiters;
+
+    /** First error. */
+    std::optional<ignite_error> m_error;
+
+    /** Closed flag. */
+    bool m_closed{false};
+
+    /** Progress. */
+    data_streamer_progress m_progress;
+
+    /** Auto flush thread. */
+    std::thread m_thread;
+};
+
+} // namespace ignite::detail
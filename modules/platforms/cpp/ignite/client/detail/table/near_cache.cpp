@@ -0,0 +1,136 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/table/near_cache.h"
+#include "ignite/client/detail/table/tuple_page.h"
+
+namespace ignite::detail {
+
+std::optional<ignite_tuple> near_cache::get(const std::string &key, std::int32_t schema_version) {
+    std::shared_ptr<schema> sch;
+    std::vector<std::byte> row;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto found = find(key, schema_version);
+        if (!found)
+            return std::nullopt;
+
+        sch = found->sch;
+        row = found->row;
+    }
+
+    return std::make_shared<tuple_page>(std::move(sch), false)->add_row(row);
+}
+
+bool near_cache::contains(const std::string &key, std::int32_t schema_version) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return find(key, schema_version) != nullptr;
+}
+
+std::uint64_t near_cache::get_generation() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_generation;
+}
+
+void near_cache::put(const std::string &key, std::shared_ptr<schema> sch, bytes_view row, std::uint64_t generation) {
+    if (key.size() + row.size() > m_options.max_size_bytes())
+        return;
+
+    std::chrono::steady_clock::time_point expires;
+    if (m_options.ttl().count() > 0)
+        expires = std::chrono::steady_clock::now() + m_options.ttl();
+    else
+        expires = std::chrono::steady_clock::time_point::max();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (generation != m_generation)
+        return;
+
+    auto it = m_index.find(key);
+    if (it != m_index.end())
+        remove(it->second);
+
+    m_entries.push_front({key, std::move(sch), {row.begin(), row.end()}, expires});
+    m_index.emplace(m_entries.front().key, m_entries.begin());
+    m_statistics.size_bytes += m_entries.front().size();
+
+    while (m_statistics.size_bytes > m_options.max_size_bytes()) {
+        remove(std::prev(m_entries.end()));
+        ++m_statistics.evictions;
+    }
+}
+
+void near_cache::invalidate(const std::vector<std::string> &keys) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    ++m_generation;
+    for (const auto &key : keys) {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            continue;
+
+        remove(it->second);
+        ++m_statistics.invalidations;
+    }
+}
+
+near_cache_statistics near_cache::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto res = m_statistics;
+    res.entry_count = m_entries.size();
+
+    return res;
+}
+
+const near_cache::entry *near_cache::find(const std::string &key, std::int32_t schema_version) {
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    auto entry_it = it->second;
+    if (entry_it->expires <= std::chrono::steady_clock::now()) {
+        remove(entry_it);
+        ++m_statistics.expirations;
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    if (entry_it->sch->version != schema_version) {
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, entry_it);
+    ++m_statistics.hits;
+
+    return &*entry_it;
+}
+
+void near_cache::remove(entry_list::iterator it) {
+    m_statistics.size_bytes -= it->size();
+    m_index.erase(it->key);
+    m_entries.erase(it);
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,178 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/table/ignite_tuple.h"
+#include "ignite/client/table/near_cache_options.h"
+#include "ignite/client/table/near_cache_statistics.h"
+
+#include "ignite/common/bytes_view.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Near cache of a table.
+ *
+ * Rows are stored as binary tuples, keyed by the encoded key columns, and are decoded on every hit. Entries are
+ * evicted in the least recently used order once the total size of keys and rows exceeds the limit.
+ */
+class near_cache {
+public:
+    // Deleted
+    near_cache() = delete;
+    near_cache(near_cache &&) = delete;
+    near_cache(const near_cache &) = delete;
+    near_cache &operator=(near_cache &&) = delete;
+    near_cache &operator=(const near_cache &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param options Options.
+     */
+    explicit near_cache(const near_cache_options &options)
+        : m_options(options) {}
+
+    /**
+     * Get a row.
+     *
+     * @param key Encoded key.
+     * @param schema_version Latest schema version. Rows of other versions are not returned.
+     * @return Row if it is cached.
+     */
+    [[nodiscard]] std::optional<ignite_tuple> get(const std::string &key, std::int32_t schema_version);
+
+    /**
+     * Check whether a row is cached.
+     *
+     * @param key Encoded key.
+     * @param schema_version Latest schema version. Rows of other versions are not taken into account.
+     * @return @c true if the row is cached.
+     */
+    [[nodiscard]] bool contains(const std::string &key, std::int32_t schema_version);
+
+    /**
+     * Get the current generation. It changes on every invalidation, so a row which was read from the server
+     * concurrently with a write is not cached.
+     *
+     * @return Generation.
+     */
+    [[nodiscard]] std::uint64_t get_generation() const;
+
+    /**
+     * Put a row read from the server.
+     *
+     * @param key Encoded key.
+     * @param sch Schema of the row.
+     * @param row Row encoded as a binary tuple.
+     * @param generation Generation obtained before the row was requested. The row is not cached if there were
+     *   invalidations since then.
+     */
+    void put(const std::string &key, std::shared_ptr<schema> sch, bytes_view row, std::uint64_t generation);
+
+    /**
+     * Invalidate rows.
+     *
+     * @param keys Encoded keys.
+     */
+    void invalidate(const std::vector<std::string> &keys);
+
+    /**
+     * Get statistics.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] near_cache_statistics get_statistics() const;
+
+private:
+    /**
+     * Cache entry.
+     */
+    struct entry {
+        /** Encoded key. */
+        std::string key;
+
+        /** Schema of the row. */
+        std::shared_ptr<schema> sch;
+
+        /** Row encoded as a binary tuple. */
+        std::vector<std::byte> row;
+
+        /** Expiration time. */
+        std::chrono::steady_clock::time_point expires;
+
+        /**
+         * Get entry size.
+         *
+         * @return Entry size in bytes.
+         */
+        [[nodiscard]] std::size_t size() const { return key.size() + row.size(); }
+    };
+
+    /** Entry list type. */
+    typedef std::list<entry> entry_list;
+
+    /**
+     * Find a valid entry and mark it as recently used. Should be called with the mutex held.
+     *
+     * @param key Encoded key.
+     * @param schema_version Latest schema version.
+     * @return Entry or @c nullptr if there is no valid entry for the key.
+     */
+    const entry *find(const std::string &key, std::int32_t schema_version);
+
+    /**
+     * Remove an entry. Should be called with the mutex held.
+     *
+     * @param it Entry.
+     */
+    void remove(entry_list::iterator it);
+
+    /** Options. */
+    const near_cache_options m_options;
+
+    /** Mutex. */
+    mutable std::mutex m_mutex;
+
+    /** Entries, from the most to the least recently used one. */
+    entry_list m_entries;
+
+    /** Entries by key. Keys reference the keys stored in the entries. */
+    std::unordered_map<std::string_view, entry_list::iterator> m_index;
+
+    /** Generation. */
+    std::uint64_t m_generation{0};
+
+    /** Statistics. */
+    near_cache_statistics m_statistics;
+};
+
+} // namespace ignite::detail
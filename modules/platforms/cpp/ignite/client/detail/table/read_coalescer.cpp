@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/table/read_coalescer.h"
+
+#include <algorithm>
+#include <string>
+
+namespace ignite::detail {
+
+void read_coalescer::get(
+    std::int32_t schema_version, std::string key, ignite_callback<std::optional<ignite_tuple>> callback) {
+    std::vector<pending_read> batch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back({schema_version, std::move(key), std::move(callback)});
+
+        if (m_in_flight < m_options.max_batches_in_flight()
+            || m_pending.size() >= std::size_t(m_options.max_batch_size()))
+            batch = take_batch();
+    }
+
+    if (!batch.empty())
+        send(std::move(batch));
+}
+
+std::vector<read_coalescer::pending_read> read_coalescer::take_batch() {
+    std::vector<pending_read> batch;
+    if (m_pending.empty())
+        return batch;
+
+    auto max_size = std::size_t(std::max(m_options.max_batch_size(), 1));
+    auto schema_version = m_pending.front().schema_version;
+
+    // Reads with keys encoded for another schema version stay pending, in order, for one of the next batches.
+    std::vector<pending_read> rest;
+    for (auto &read : m_pending) {
+        if (batch.size() < max_size && read.schema_version == schema_version)
+            batch.push_back(std::move(read));
+        else
+            rest.push_back(std::move(read));
+    }
+    m_pending = std::move(rest);
+
+    ++m_in_flight;
+
+    return batch;
+}
+
+void read_coalescer::send(std::vector<pending_read> batch) {
+    auto schema_version = batch.front().schema_version;
+
+    std::vector<std::string> keys;
+    keys.reserve(batch.size());
+    for (auto &read : batch)
+        keys.push_back(std::move(read.key));
+
+    auto shared_batch = std::make_shared<std::vector<pending_read>>(std::move(batch));
+    auto callback = [self = shared_from_this(), shared_batch](
+                        ignite_result<std::vector<std::optional<ignite_tuple>>> &&res) {
+        self->on_batch_done(std::move(*shared_batch), std::move(res));
+    };
+
+    try {
+        m_sender(schema_version, std::move(keys), std::move(callback));
+    } catch (ignite_error &err) {
+        on_batch_done(std::move(*shared_batch), {std::move(err)});
+    }
+}
+
+void read_coalescer::on_batch_done(
+    std::vector<pending_read> batch, ignite_result<std::vector<std::optional<ignite_tuple>>> &&res) {
+    std::vector<pending_read> next;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_in_flight;
+
+        if (!m_pending.empty())
+            next = take_batch();
+    }
+
+    if (res.has_value() && res.value().size() != batch.size())
+        res = ignite_error("Unexpected number of records in the response: " + std::to_string(res.value().size()));
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        try {
+            if (res.has_error())
+                batch[i].callback({ignite_error(res.error())});
+            else
+                batch[i].callback({std::move(res.value()[i])});
+        } catch (...) {
+            // Callbacks of different callers are independent, one of them throwing must not leave the rest uncalled.
+        }
+    }
+
+    if (!next.empty())
+        send(std::move(next));
+}
+
+} // namespace ignite::detail
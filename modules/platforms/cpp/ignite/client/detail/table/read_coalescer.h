@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/table/ignite_tuple.h"
+#include "ignite/client/table/read_coalescing_options.h"
+
+#include "ignite/common/ignite_result.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Coalesces single-key reads into batches.
+ */
+class read_coalescer : public std::enable_shared_from_this<read_coalescer> {
+public:
+    /**
+     * Function which sends a batch of keys encoded with the schema of the given version and calls the callback with
+     * a record for every key, in the order of the keys, and @c std::nullopt for the keys which do not exist.
+     */
+    typedef std::function<void(
+        std::int32_t, std::vector<std::string>, ignite_callback<std::vector<std::optional<ignite_tuple>>>)>
+        batch_sender;
+
+    // Deleted
+    read_coalescer() = delete;
+    read_coalescer(read_coalescer &&) = delete;
+    read_coalescer(const read_coalescer &) = delete;
+    read_coalescer &operator=(read_coalescer &&) = delete;
+    read_coalescer &operator=(const read_coalescer &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param options Options.
+     * @param sender Batch sender.
+     */
+    read_coalescer(const read_coalescing_options &options, batch_sender sender)
+        : m_options(options)
+        , m_sender(std::move(sender)) {}
+
+    /**
+     * Get a record by key.
+     *
+     * The key should be validated and encoded by the caller, so a key which can not be encoded never makes it into
+     * a batch and fails nobody but its own caller.
+     *
+     * @param schema_version Version of the schema the key is encoded with.
+     * @param key Encoded key.
+     * @param callback Callback.
+     */
+    void get(std::int32_t schema_version, std::string key, ignite_callback<std::optional<ignite_tuple>> callback);
+
+private:
+    /**
+     * Read waiting to be sent.
+     */
+    struct pending_read {
+        /** Version of the schema the key is encoded with. */
+        std::int32_t schema_version;
+
+        /** Encoded key. */
+        std::string key;
+
+        /** Callback. */
+        ignite_callback<std::optional<ignite_tuple>> callback;
+    };
+
+    /**
+     * Take a batch of pending reads with the same schema version as the oldest one. Should be called with the mutex
+     * held.
+     *
+     * @return Batch.
+     */
+    std::vector<pending_read> take_batch();
+
+    /**
+     * Send a batch.
+     *
+     * @param batch Batch.
+     */
+    void send(std::vector<pending_read> batch);
+
+    /**
+     * Handle a completed batch.
+     *
+     * @param batch Batch.
+     * @param res Result.
+     */
+    void on_batch_done(std::vector<pending_read> batch, ignite_result<std::vector<std::optional<ignite_tuple>>> &&res);
+
+    /** Options. */
+    const read_coalescing_options m_options;
+
+    /** Batch sender. */
+    const batch_sender m_sender;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Reads waiting to be sent. */
+    std::vector<pending_read> m_pending;
+
+    /** Number of batches in flight. */
+    std::int32_t m_in_flight{0};
+};
+
+} // namespace ignite::detail
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "ignite/client/table/ignite_tuple.h"
 #include "ignite/common/ignite_error.h"
 #include "ignite/common/ignite_type.h"
 #include "ignite/protocol/utils.h"
@@ -24,8 +25,15 @@
 #include <msgpack.h>
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ignite {
+class binary_tuple_builder;
+} // namespace ignite
 
 namespace ignite::detail {
 
@@ -66,17 +74,106 @@ struct column {
     }
 };
 
+/**
+ * Binding plan of a tuple of the specific shape to the schema columns.
+ *
+ * Maps every schema column to the ordinal of the corresponding tuple column and holds type-specific encoders for
+ * it, so tuples of the same shape can be serialized without any column name lookups.
+ */
+struct binding_plan {
+    /** Column value encoder. */
+    typedef void (*encoder)(binary_tuple_builder &builder, const primitive &value, std::int32_t scale);
+
+    /** Encoder of a column value taken straight from the tuple source. */
+    typedef tuple_source::encoder source_encoder;
+
+    /**
+     * Binding of a single schema column.
+     */
+    struct column_binding {
+        /** Ordinal of the column in the tuple, or -1 if the tuple does not contain the column. */
+        std::int32_t tuple_idx{-1};
+
+        /** Column scale. */
+        std::int32_t scale{0};
+
+        /** Encoder used to append the value. */
+        encoder append{nullptr};
+
+        /** Source encoder used to append the value. */
+        source_encoder source_append{nullptr};
+    };
+
+    /** Whether only key columns are bound. */
+    bool key_only{false};
+
+    /** Layout of the tuple source for the tuples with source encoders, or @c nullptr. */
+    const void *layout{nullptr};
+
+    /** Number of columns in the tuple. */
+    std::int32_t column_count{0};
+
+    /** Shape hash of the tuple. Not used if the layout is set. */
+    std::size_t shape_hash{0};
+
+    /**
+     * Column names of the tuple the plan was built for, as given by the tuple. Not used if the layout is set.
+     *
+     * Compared on a shape hash hit, so tuples with colliding hashes never share a plan.
+     */
+    std::vector<std::string> column_names;
+
+    /** Bindings, one per bound schema column. */
+    std::vector<column_binding> columns;
+};
+
 /**
  * Schema.
  */
 struct schema {
+    /**
+     * Maximum number of binding plans cached per schema.
+     *
+     * Cached plans are never evicted, so once all the slots are taken, tuples of any other shape get their plan built
+     * on every write.
+     */
+    static constexpr std::size_t MAX_BINDING_PLANS = 16;
+
     std::int32_t version{-1};
     std::int32_t key_column_count{0};
     std::vector<column> columns;
 
+    /** Column ordinals by the normalized column names. */
+    std::unordered_map<std::string, std::int32_t> ordinals;
+
+    /** Shape hash of the rows with all the columns. */
+    std::size_t shape_hash{0};
+
+    /** Shape hash of the rows with the key columns only. */
+    std::size_t key_shape_hash{0};
+
+    /**
+     * Binding plans for the tuple shapes used with the schema.
+     *
+     * Slots are filled once and never replaced or evicted, so the plans can be looked up without locking. Plans for
+     * the shapes which do not fit are built on every use.
+     */
+    mutable std::array<std::atomic<const binding_plan *>, MAX_BINDING_PLANS> plans{};
+
     // Default
     schema() = default;
 
+    /**
+     * Destructor.
+     */
+    ~schema() {
+        for (auto &plan : plans)
+            delete plan.load(std::memory_order_relaxed);
+    }
+
+    schema(const schema &) = delete;
+    schema &operator=(const schema &) = delete;
+
     /**
      * Constructor.
      *
@@ -87,7 +184,17 @@ struct schema {
     schema(std::int32_t version, std::int32_t key_column_count, std::vector<column> &&columns)
         : version(version)
         , key_column_count(key_column_count)
-        , columns(std::move(columns)) {}
+        , columns(std::move(columns)) {
+        ordinals.reserve(this->columns.size());
+        for (std::size_t i = 0; i < this->columns.size(); ++i) {
+            auto parsed_name = tuple_source::parse_name(this->columns[i].name);
+            shape_hash = tuple_source::add_to_shape_hash(shape_hash, parsed_name);
+            if (std::int32_t(i + 1) == key_column_count)
+                key_shape_hash = shape_hash;
+
+            ordinals.emplace(std::move(parsed_name), std::int32_t(i));
+        }
+    }
 
     /**
      * Read schema using reader.
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/common/ignite_result.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Deduplicates identical requests which are in flight at the same time.
+ *
+ * The first caller for a key performs the request, and the callers which come while it is in flight get the same
+ * result.
+ */
+template<typename T>
+class single_flight : public std::enable_shared_from_this<single_flight<T>> {
+public:
+    /**
+     * Join the request for the key.
+     *
+     * @param key Request key.
+     * @param callback Callback.
+     * @return Callback to perform the request with if the caller is the first one, or @c std::nullopt if the
+     *   caller was attached to the request in flight.
+     */
+    [[nodiscard]] std::optional<ignite_callback<T>> join(const std::string &key, ignite_callback<T> callback) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto [it, inserted] = m_flights.try_emplace(key);
+        it->second.push_back(std::move(callback));
+        if (!inserted) {
+            ++m_deduplicated;
+            return std::nullopt;
+        }
+
+        return ignite_callback<T>{[self = this->shared_from_this(), key](ignite_result<T> &&res) {
+            self->complete(key, std::move(res));
+        }};
+    }
+
+    /**
+     * Get the number of requests which were attached to the requests in flight.
+     *
+     * @return Number of deduplicated requests.
+     */
+    [[nodiscard]] std::int64_t get_deduplicated() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_deduplicated;
+    }
+
+private:
+    /**
+     * Complete the request for the key.
+     *
+     * @param key Request key.
+     * @param res Result.
+     */
+    void complete(const std::string &key, ignite_result<T> &&res) {
+        std::vector<ignite_callback<T>> waiters;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_flights.find(key);
+            if (it == m_flights.end())
+                return;
+
+            waiters = std::move(it->second);
+            m_flights.erase(it);
+        }
+
+        for (std::size_t i = 0; i + 1 < waiters.size(); ++i) {
+            auto copy = res;
+            waiters[i](std::move(copy));
+        }
+        waiters.back()(std::move(res));
+    }
+
+    /** Mutex. */
+    mutable std::mutex m_mutex;
+
+    /** Callbacks of the requests in flight by key. */
+    std::unordered_map<std::string, std::vector<ignite_callback<T>>> m_flights;
+
+    /** Number of deduplicated requests. */
+    std::int64_t m_deduplicated{0};
+};
+
+} // namespace ignite::detail
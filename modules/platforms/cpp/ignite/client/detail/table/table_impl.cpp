@@ -17,6 +17,7 @@
 
 #include "table_impl.h"
 
+#include "ignite/client/detail/table/tuple_page.h"
 #include "ignite/client/detail/transaction/transaction_impl.h"
 #include "ignite/client/detail/utils.h"
 #include "ignite/client/table/table.h"
@@ -27,6 +28,8 @@
 #include "ignite/protocol/writer.h"
 #include "ignite/tuple/binary_tuple_parser.h"
 
+#include <algorithm>
+
 namespace ignite::detail {
 
 /**
@@ -42,30 +45,57 @@ void write_table_operation_header(protocol::writer &writer, uuid id, transaction
     if (!tx)
         writer.write_nil();
     else
-        writer.write(tx->get_id());
+        tx->write_id(writer);
 
     writer.write(sch.version);
 }
 
 /**
- * Read tuple.
+ * Serialize data into a standalone buffer.
  *
- * @param reader Reader.
- * @param sch Schema.
- * @return Tuple.
+ * @param func Function that writes the data.
+ * @return Serialized data.
  */
-ignite_tuple read_tuple(protocol::reader &reader, const schema *sch) {
-    auto tuple_data = reader.read_binary();
+std::vector<std::byte> serialize(const std::function<void(protocol::writer &)> &func) {
+    std::vector<std::byte> data;
+    {
+        protocol::buffer_adapter buffer(data);
+        protocol::writer writer(buffer);
+        func(writer);
+    }
+    return data;
+}
 
-    auto columns_cnt = std::int32_t(sch->columns.size());
-    ignite_tuple res(columns_cnt);
-    binary_tuple_parser parser(columns_cnt, tuple_data);
+/**
+ * Buffer upsert of a record within a transaction.
+ *
+ * @param tx Transaction.
+ * @param id Table ID.
+ * @param sch Table schema.
+ * @param record Record.
+ */
+void buffer_upsert(transaction_impl &tx, uuid id, const schema &sch, const ignite_tuple &record) {
+    auto key = serialize([&](protocol::writer &writer) { write_tuple(writer, sch, record, true); });
+    auto data = serialize([&](protocol::writer &writer) { write_tuple(writer, sch, record, false); });
 
-    for (std::int32_t i = 0; i < columns_cnt; ++i) {
-        auto &column = sch->columns[i];
-        res.set(column.name, read_next_column(parser, column.type, column.scale));
-    }
-    return res;
+    tx.buffer_upsert(id, sch.version, std::move(key), std::move(data));
+}
+
+/**
+ * Buffer upsert of a record given as separate key and value tuples within a transaction.
+ *
+ * @param tx Transaction.
+ * @param id Table ID.
+ * @param sch Table schema.
+ * @param key Key.
+ * @param value Value.
+ */
+void buffer_upsert(
+    transaction_impl &tx, uuid id, const schema &sch, const ignite_tuple &key, const ignite_tuple &value) {
+    auto key_data = serialize([&](protocol::writer &writer) { write_tuple(writer, sch, key, true); });
+    auto data = serialize([&](protocol::writer &writer) { write_tuple(writer, sch, key, value); });
+
+    tx.buffer_upsert(id, sch.version, std::move(key_data), std::move(data));
 }
 
 /**
@@ -76,18 +106,10 @@ ignite_tuple read_tuple(protocol::reader &reader, const schema *sch) {
  * @param key_only Should only key fields be read or not.
  * @return Tuple.
  */
-ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, bool key_only) {
-    auto tuple_data = reader.read_binary();
+ignite_tuple read_tuple(protocol::reader &reader, std::shared_ptr<schema> sch, bool key_only) {
+    auto page = std::make_shared<tuple_page>(std::move(sch), key_only);
 
-    auto columns_cnt = std::int32_t(key_only ? sch->key_column_count : sch->columns.size());
-    ignite_tuple res(columns_cnt);
-    binary_tuple_parser parser(columns_cnt, tuple_data);
-
-    for (std::int32_t i = 0; i < columns_cnt; ++i) {
-        auto &column = sch->columns[i];
-        res.set(column.name, read_next_column(parser, column.type, column.scale));
-    }
-    return res;
+    return page->add_row(reader.read_binary());
 }
 
 /**
@@ -98,7 +120,8 @@ ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, bool key_on
  * @param key_only Should only key fields be read or not.
  * @return Tuples.
  */
-std::vector<std::optional<ignite_tuple>> read_tuples_opt(protocol::reader &reader, const schema *sch, bool key_only) {
+std::vector<std::optional<ignite_tuple>> read_tuples_opt(
+    protocol::reader &reader, std::shared_ptr<schema> sch, bool key_only) {
     if (reader.try_read_nil())
         return {};
 
@@ -106,12 +129,13 @@ std::vector<std::optional<ignite_tuple>> read_tuples_opt(protocol::reader &reade
     std::vector<std::optional<ignite_tuple>> res;
     res.reserve(std::size_t(count));
 
+    auto page = std::make_shared<tuple_page>(std::move(sch), key_only);
     for (std::int32_t i = 0; i < count; ++i) {
         auto exists = reader.read_bool();
         if (!exists)
             res.emplace_back(std::nullopt);
         else
-            res.emplace_back(read_tuple(reader, sch, key_only));
+            res.emplace_back(page->add_row(reader.read_binary()));
     }
 
     return res;
@@ -125,7 +149,7 @@ std::vector<std::optional<ignite_tuple>> read_tuples_opt(protocol::reader &reade
  * @param key_only Should only key fields be read or not.
  * @return Tuples.
  */
-std::vector<ignite_tuple> read_tuples(protocol::reader &reader, const schema *sch, bool key_only) {
+std::vector<ignite_tuple> read_tuples(protocol::reader &reader, std::shared_ptr<schema> sch, bool key_only) {
     if (reader.try_read_nil())
         return {};
 
@@ -133,8 +157,34 @@ std::vector<ignite_tuple> read_tuples(protocol::reader &reader, const schema *sc
     std::vector<ignite_tuple> res;
     res.reserve(std::size_t(count));
 
+    auto page = std::make_shared<tuple_page>(std::move(sch), key_only);
     for (std::int32_t i = 0; i < count; ++i)
-        res.emplace_back(read_tuple(reader, sch, key_only));
+        res.emplace_back(page->add_row(reader.read_binary()));
+
+    return res;
+}
+
+std::string table_impl::encode_key(const schema &sch, const ignite_tuple &key) {
+    auto data = serialize([&](protocol::writer &writer) { write_tuple(writer, sch, key, true); });
+
+    return {reinterpret_cast<const char *>(data.data()), data.size()};
+}
+
+std::vector<std::string> table_impl::encode_keys(const schema &sch, const std::vector<ignite_tuple> &keys) {
+    std::vector<std::string> res;
+    res.reserve(keys.size());
+    for (const auto &key : keys)
+        res.push_back(encode_key(sch, key));
+
+    return res;
+}
+
+std::vector<std::string> table_impl::encode_keys(
+    const schema &sch, const std::vector<std::pair<ignite_tuple, ignite_tuple>> &pairs) {
+    std::vector<std::string> res;
+    res.reserve(pairs.size());
+    for (const auto &pair : pairs)
+        res.push_back(encode_key(sch, pair.first));
 
     return res;
 }
@@ -182,22 +232,62 @@ void table_impl::load_schema_async(ignite_callback<std::shared_ptr<schema>> call
 
 void table_impl::get_async(
     transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<ignite_tuple>> callback) {
+    if (!tx) {
+        std::unique_lock<std::mutex> lock(m_read_flights_mutex);
+        auto flights = m_get_flights;
+        lock.unlock();
+
+        if (flights) {
+            perform_deduplicated_async(std::move(flights), key, std::move(callback), &table_impl::perform_get_async);
+            return;
+        }
+    }
+
+    perform_get_async(tx, key, std::move(callback));
+}
+
+void table_impl::perform_get_async(
+    transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<ignite_tuple>> callback) {
+    auto coalescer = tx ? nullptr : get_read_coalescer();
+    if (coalescer) {
+        coalesced_get_async(std::move(coalescer), key, std::move(callback));
+        return;
+    }
 
     with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), key = std::make_shared<ignite_tuple>(key), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            // Transactional reads must see the state of the transaction, so they bypass the near cache.
+            auto cache = tx0 ? nullptr : self->get_near_cache();
+            std::string cache_key;
+            std::uint64_t generation{0};
+            if (cache) {
+                cache_key = encode_key(sch, *key);
+                auto cached = cache->get(cache_key, sch.version);
+                if (cached) {
+                    callback({std::move(cached)});
+                    return;
+                }
+                generation = cache->get_generation();
+            }
+
             auto writer_func = [self, key, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, *key, true);
             };
 
-            auto reader_func = [self, key](protocol::reader &reader) -> std::optional<ignite_tuple> {
+            auto reader_func = [self, key, cache, cache_key = std::move(cache_key), generation](
+                                   protocol::reader &reader) -> std::optional<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
 
                 if (reader.try_read_nil())
                     return std::nullopt;
 
-                return read_tuple(reader, sch.get());
+                auto row = reader.read_binary();
+                if (cache)
+                    cache->put(cache_key, sch, row, generation);
+
+                return std::make_shared<tuple_page>(std::move(sch), false)->add_row(row);
             };
 
             self->m_connection->perform_request<std::optional<ignite_tuple>>(
@@ -206,10 +296,43 @@ void table_impl::get_async(
 }
 
 void table_impl::contains_async(transaction *tx, const ignite_tuple &key, ignite_callback<bool> callback) {
+    if (!tx) {
+        std::unique_lock<std::mutex> lock(m_read_flights_mutex);
+        auto flights = m_contains_flights;
+        lock.unlock();
+
+        if (flights) {
+            perform_deduplicated_async(
+                std::move(flights), key, std::move(callback), &table_impl::perform_contains_async);
+            return;
+        }
+    }
+
+    perform_contains_async(tx, key, std::move(callback));
+}
+
+void table_impl::perform_contains_async(transaction *tx, const ignite_tuple &key, ignite_callback<bool> callback) {
+    auto coalescer = tx ? nullptr : get_read_coalescer();
+    if (coalescer) {
+        coalesced_get_async(std::move(coalescer), key,
+            [callback = std::move(callback)](ignite_result<std::optional<ignite_tuple>> &&res) {
+                if (res.has_error())
+                    callback({std::move(res).error()});
+                else
+                    callback({res.value().has_value()});
+            });
+        return;
+    }
 
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), key = std::make_shared<ignite_tuple>(key), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            auto cache = tx0 ? nullptr : self->get_near_cache();
+            if (cache && cache->contains(encode_key(sch, *key), sch.version)) {
+                callback({true});
+                return;
+            }
+
             auto writer_func = [self, key, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, *key, true);
@@ -232,6 +355,25 @@ void table_impl::get_all_async(transaction *tx, std::vector<ignite_tuple> keys,
     auto shared_keys = std::make_shared<std::vector<ignite_tuple>>(std::move(keys));
     with_latest_schema_async<std::vector<std::optional<ignite_tuple>>>(std::move(callback),
         [self = shared_from_this(), keys = shared_keys, tx0 = to_impl(tx)](const schema &sch, auto callback) mutable {
+            auto cache = tx0 ? nullptr : self->get_near_cache();
+            if (cache) {
+                // Like the server, only return the records which exist.
+                auto found_only = [callback = std::move(callback)](
+                                      ignite_result<std::vector<std::optional<ignite_tuple>>> &&res) {
+                    if (res.has_error()) {
+                        callback(std::move(res));
+                        return;
+                    }
+
+                    auto records = std::move(res).value();
+                    records.erase(std::remove(records.begin(), records.end(), std::nullopt), records.end());
+                    callback({std::move(records)});
+                };
+
+                self->get_all_near_cache_async(sch, std::move(cache), encode_keys(sch, *keys), std::move(found_only));
+                return;
+            }
+
             auto writer_func = [self, keys, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuples(writer, sch, *keys, true);
@@ -239,7 +381,7 @@ void table_impl::get_all_async(transaction *tx, std::vector<ignite_tuple> keys,
 
             auto reader_func = [self](protocol::reader &reader) -> std::vector<std::optional<ignite_tuple>> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples_opt(reader, sch.get(), false);
+                return read_tuples_opt(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::vector<std::optional<ignite_tuple>>>(
@@ -247,10 +389,151 @@ void table_impl::get_all_async(transaction *tx, std::vector<ignite_tuple> keys,
         });
 }
 
+void table_impl::get_all_near_cache_async(const schema &sch, std::shared_ptr<near_cache> cache,
+    std::vector<std::string> cache_keys, ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
+    std::vector<std::optional<ignite_tuple>> found(cache_keys.size());
+    std::vector<std::size_t> missing;
+    for (std::size_t i = 0; i < cache_keys.size(); ++i) {
+        found[i] = cache->get(cache_keys[i], sch.version);
+        if (!found[i])
+            missing.push_back(i);
+    }
+
+    if (missing.empty()) {
+        callback({std::move(found)});
+        return;
+    }
+
+    auto generation = cache->get_generation();
+
+    key_positions positions;
+    for (auto idx : missing)
+        positions[cache_keys[idx]].push_back(idx);
+
+    // Only the keys which are not cached are requested. Cache keys are the encoded keys, so they are written as is.
+    auto writer_func = [this, &cache_keys, &missing, &sch](protocol::writer &writer) {
+        write_table_operation_header(writer, m_id, nullptr, sch);
+        writer.write(std::int32_t(missing.size()));
+        for (auto idx : missing)
+            writer.write_raw(cache_keys[idx]);
+    };
+
+    auto reader_func = [self = shared_from_this(), key_sch = get_schema(sch.version), cache = std::move(cache),
+                           cache_keys = std::move(cache_keys), positions = std::move(positions),
+                           found = std::move(found), generation](
+                           protocol::reader &reader) mutable -> std::vector<std::optional<ignite_tuple>> {
+        std::shared_ptr<schema> sch = self->get_schema(reader);
+        read_matched_tuples(
+            reader, sch, *key_sch, positions, [&](std::size_t idx, bytes_view row, ignite_tuple record) {
+                cache->put(cache_keys[idx], sch, row, generation);
+                found[idx] = std::move(record);
+            });
+
+        return std::move(found);
+    };
+
+    m_connection->perform_request<std::vector<std::optional<ignite_tuple>>>(
+        client_operation::TUPLE_GET_ALL, nullptr, writer_func, std::move(reader_func), std::move(callback));
+}
+
+void table_impl::read_matched_tuples(protocol::reader &reader, std::shared_ptr<schema> sch, const schema &key_sch,
+    const key_positions &positions, const std::function<void(std::size_t, bytes_view, ignite_tuple)> &func) {
+    if (reader.try_read_nil())
+        return;
+
+    auto count = reader.read_int32();
+    auto page = std::make_shared<tuple_page>(std::move(sch), false);
+
+    // All the rows are added to the page before the key columns of any of them are read.
+    std::vector<bytes_view> rows;
+    std::vector<ignite_tuple> records;
+    rows.reserve(std::size_t(count));
+    records.reserve(std::size_t(count));
+    for (std::int32_t i = 0; i < count; ++i) {
+        if (!reader.read_bool())
+            continue;
+
+        rows.push_back(reader.read_binary());
+        records.push_back(page->add_row(rows.back()));
+    }
+
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        auto it = positions.find(encode_key(key_sch, records[i]));
+        if (it == positions.end())
+            continue;
+
+        for (auto idx : it->second)
+            func(idx, rows[i], records[i]);
+    }
+}
+
+void table_impl::get_all_encoded_async(std::int32_t schema_version, std::vector<std::string> keys,
+    ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
+    auto sch = get_schema(schema_version);
+    if (!sch) {
+        callback({ignite_error("Can not get a schema for the table " + m_name)});
+        return;
+    }
+
+    auto cache = get_near_cache();
+    if (cache) {
+        get_all_near_cache_async(*sch, std::move(cache), std::move(keys), std::move(callback));
+        return;
+    }
+
+    auto writer_func = [this, &keys, &sch](protocol::writer &writer) {
+        write_table_operation_header(writer, m_id, nullptr, *sch);
+        writer.write(std::int32_t(keys.size()));
+        for (const auto &key : keys)
+            writer.write_raw(key);
+    };
+
+    key_positions positions;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        positions[keys[i]].push_back(i);
+
+    auto reader_func = [self = shared_from_this(), key_sch = sch, positions = std::move(positions),
+                           count = keys.size()](protocol::reader &reader) -> std::vector<std::optional<ignite_tuple>> {
+        std::shared_ptr<schema> sch = self->get_schema(reader);
+
+        std::vector<std::optional<ignite_tuple>> res(count);
+        read_matched_tuples(reader, std::move(sch), *key_sch, positions,
+            [&res](std::size_t idx, bytes_view, ignite_tuple record) { res[idx] = std::move(record); });
+
+        return res;
+    };
+
+    m_connection->perform_request<std::vector<std::optional<ignite_tuple>>>(
+        client_operation::TUPLE_GET_ALL, nullptr, writer_func, std::move(reader_func), std::move(callback));
+}
+
+void table_impl::coalesced_get_async(std::shared_ptr<read_coalescer> coalescer, const ignite_tuple &key,
+    ignite_callback<std::optional<ignite_tuple>> callback) {
+    with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
+        [coalescer = std::move(coalescer), key = std::make_shared<ignite_tuple>(key)](
+            const schema &sch, auto callback) mutable {
+            auto encoded = result_of_operation<std::string>([&] { return encode_key(sch, *key); });
+            if (encoded.has_error()) {
+                callback({std::move(encoded).error()});
+                return;
+            }
+
+            coalescer->get(sch.version, std::move(encoded).value(), std::move(callback));
+        });
+}
+
 void table_impl::upsert_async(transaction *tx, const ignite_tuple &record, ignite_callback<void> callback) {
     with_latest_schema_async<void>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
+            if (tx0 && tx0->is_write_buffering_enabled()) {
+                buffer_upsert(*tx0, self->m_id, sch, record);
+                callback({});
+                return;
+            }
+
             auto writer_func = [self, &record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, false);
@@ -262,10 +545,24 @@ void table_impl::upsert_async(transaction *tx, const ignite_tuple &record, ignit
 }
 
 void table_impl::upsert_all_async(transaction *tx, std::vector<ignite_tuple> records, ignite_callback<void> callback) {
-    auto shared_records = std::make_shared<std::vector<ignite_tuple>>(std::move(records));
+    upsert_all_async(tx, std::make_shared<const std::vector<ignite_tuple>>(std::move(records)), std::move(callback));
+}
+
+void table_impl::upsert_all_async(
+    transaction *tx, std::shared_ptr<const std::vector<ignite_tuple>> records, ignite_callback<void> callback) {
     with_latest_schema_async<void>(std::move(callback),
-        [self = shared_from_this(), records = shared_records, tx0 = to_impl(tx)](
+        [self = shared_from_this(), records = std::move(records), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, *records, tx0.get(), std::move(callback));
+
+            if (tx0 && tx0->is_write_buffering_enabled()) {
+                for (const auto &record : *records)
+                    buffer_upsert(*tx0, self->m_id, sch, record);
+
+                callback({});
+                return;
+            }
+
             auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuples(writer, sch, *records, false);
@@ -282,6 +579,8 @@ void table_impl::get_and_upsert_async(
     with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), record = std::make_shared<ignite_tuple>(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) {
+            callback = self->invalidate_reads(sch, *record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, *record, false);
@@ -293,7 +592,7 @@ void table_impl::get_and_upsert_async(
                 if (reader.try_read_nil())
                     return std::nullopt;
 
-                return read_tuple(reader, sch.get());
+                return read_tuple(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET_AND_UPSERT,
@@ -305,6 +604,8 @@ void table_impl::insert_async(transaction *tx, const ignite_tuple &record, ignit
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, false);
@@ -328,6 +629,8 @@ void table_impl::insert_all_async(
     with_latest_schema_async<std::vector<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), records = shared_records, tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, *records, tx0.get(), std::move(callback));
+
             auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuples(writer, sch, *records, false);
@@ -335,7 +638,7 @@ void table_impl::insert_all_async(
 
             auto reader_func = [self, records](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), false);
+                return read_tuples(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(client_operation::TUPLE_INSERT_ALL,
@@ -347,6 +650,8 @@ void table_impl::replace_async(transaction *tx, const ignite_tuple &record, igni
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, false);
@@ -368,6 +673,8 @@ void table_impl::replace_async(
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(record), new_record = ignite_tuple(new_record),
             tx0 = to_impl(tx)](const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &record, &new_record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, false);
@@ -391,6 +698,8 @@ void table_impl::get_and_replace_async(
     with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), record = std::make_shared<ignite_tuple>(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, *record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, *record, false);
@@ -402,7 +711,7 @@ void table_impl::get_and_replace_async(
                 if (reader.try_read_nil())
                     return std::nullopt;
 
-                return read_tuple(reader, sch.get());
+                return read_tuple(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET_AND_REPLACE,
@@ -414,6 +723,8 @@ void table_impl::remove_async(transaction *tx, const ignite_tuple &key, ignite_c
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(key), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, true);
@@ -434,6 +745,8 @@ void table_impl::remove_exact_async(transaction *tx, const ignite_tuple &record,
     with_latest_schema_async<bool>(std::move(callback),
         [self = shared_from_this(), record = ignite_tuple(record), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, record, false);
@@ -456,6 +769,8 @@ void table_impl::get_and_remove_async(
     with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), record = std::make_shared<ignite_tuple>(key), tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, *record, tx0.get(), std::move(callback));
+
             auto writer_func = [self, record, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuple(writer, sch, *record, true);
@@ -467,7 +782,7 @@ void table_impl::get_and_remove_async(
                 if (reader.try_read_nil())
                     return std::nullopt;
 
-                return read_tuple(reader, sch.get());
+                return read_tuple(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET_AND_DELETE,
@@ -480,6 +795,8 @@ void table_impl::remove_all_async(
 
     with_latest_schema_async<std::vector<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), keys = std::move(keys), tx0 = to_impl(tx)](const schema &sch, auto callback) {
+            callback = self->invalidate_reads(sch, keys, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &keys, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuples(writer, sch, keys, true);
@@ -487,7 +804,7 @@ void table_impl::remove_all_async(
 
             auto reader_func = [self](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), true);
+                return read_tuples(reader, std::move(sch), true);
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(client_operation::TUPLE_DELETE_ALL,
@@ -500,6 +817,8 @@ void table_impl::remove_all_exact_async(
 
     with_latest_schema_async<std::vector<ignite_tuple>>(std::move(callback),
         [self = shared_from_this(), records = std::move(records), tx0 = to_impl(tx)](const schema &sch, auto callback) {
+            callback = self->invalidate_reads(sch, records, tx0.get(), std::move(callback));
+
             auto writer_func = [self, &records, &sch, &tx0](protocol::writer &writer) {
                 write_table_operation_header(writer, self->m_id, tx0.get(), sch);
                 write_tuples(writer, sch, records, false);
@@ -507,7 +826,156 @@ void table_impl::remove_all_exact_async(
 
             auto reader_func = [self](protocol::reader &reader) -> std::vector<ignite_tuple> {
                 std::shared_ptr<schema> sch = self->get_schema(reader);
-                return read_tuples(reader, sch.get(), false);
+                return read_tuples(reader, std::move(sch), false);
+            };
+
+            self->m_connection->perform_request<std::vector<ignite_tuple>>(client_operation::TUPLE_DELETE_ALL_EXACT,
+                tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::put_async(
+    transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<void> callback) {
+    with_latest_schema_async<void>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            if (tx0 && tx0->is_write_buffering_enabled()) {
+                buffer_upsert(*tx0, self->m_id, sch, key, value);
+                callback({});
+                return;
+            }
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            self->m_connection->perform_request_wr(
+                client_operation::TUPLE_UPSERT, tx0.get(), writer_func, std::move(callback));
+        });
+}
+
+void table_impl::put_all_async(
+    transaction *tx, std::vector<std::pair<ignite_tuple, ignite_tuple>> pairs, ignite_callback<void> callback) {
+    put_all_async(tx, std::make_shared<const std::vector<std::pair<ignite_tuple, ignite_tuple>>>(std::move(pairs)),
+        std::move(callback));
+}
+
+void table_impl::put_all_async(transaction *tx,
+    std::shared_ptr<const std::vector<std::pair<ignite_tuple, ignite_tuple>>> pairs, ignite_callback<void> callback) {
+    with_latest_schema_async<void>(std::move(callback),
+        [self = shared_from_this(), pairs = std::move(pairs), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, *pairs, tx0.get(), std::move(callback));
+
+            if (tx0 && tx0->is_write_buffering_enabled()) {
+                for (const auto &pair : *pairs)
+                    buffer_upsert(*tx0, self->m_id, sch, pair.first, pair.second);
+
+                callback({});
+                return;
+            }
+
+            auto writer_func = [self, pairs, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuples(writer, sch, *pairs);
+            };
+
+            self->m_connection->perform_request_wr(
+                client_operation::TUPLE_UPSERT_ALL, tx0.get(), writer_func, std::move(callback));
+        });
+}
+
+void table_impl::get_and_put_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &value,
+    ignite_callback<std::optional<ignite_tuple>> callback) {
+
+    with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            auto reader_func = [self](protocol::reader &reader) -> std::optional<ignite_tuple> {
+                std::shared_ptr<schema> sch = self->get_schema(reader);
+
+                if (reader.try_read_nil())
+                    return std::nullopt;
+
+                return read_tuple(reader, std::move(sch), false);
+            };
+
+            self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET_AND_UPSERT,
+                tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::put_if_absent_async(
+    transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback) {
+    with_latest_schema_async<bool>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            auto reader_func = [](protocol::reader &reader) -> bool {
+                (void) reader.read_int32(); // Skip schema version.
+
+                return reader.read_bool();
+            };
+
+            self->m_connection->perform_request<bool>(
+                client_operation::TUPLE_INSERT, tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::remove_exact_async(
+    transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback) {
+    with_latest_schema_async<bool>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            auto reader_func = [](protocol::reader &reader) -> bool {
+                (void) reader.read_int32(); // Skip schema version.
+
+                return reader.read_bool();
+            };
+
+            self->m_connection->perform_request<bool>(client_operation::TUPLE_DELETE_EXACT, tx0.get(), writer_func,
+                std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::remove_all_exact_async(transaction *tx, std::vector<std::pair<ignite_tuple, ignite_tuple>> pairs,
+    ignite_callback<std::vector<ignite_tuple>> callback) {
+
+    with_latest_schema_async<std::vector<ignite_tuple>>(std::move(callback),
+        [self = shared_from_this(), pairs = std::move(pairs), tx0 = to_impl(tx)](const schema &sch, auto callback) {
+            callback = self->invalidate_reads(sch, pairs, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &pairs, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuples(writer, sch, pairs);
+            };
+
+            auto reader_func = [self](protocol::reader &reader) -> std::vector<ignite_tuple> {
+                std::shared_ptr<schema> sch = self->get_schema(reader);
+                return read_tuples(reader, std::move(sch), false);
             };
 
             self->m_connection->perform_request<std::vector<ignite_tuple>>(client_operation::TUPLE_DELETE_ALL_EXACT,
@@ -515,6 +983,80 @@ void table_impl::remove_all_exact_async(
         });
 }
 
+void table_impl::replace_value_async(
+    transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback) {
+    with_latest_schema_async<bool>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            auto reader_func = [](protocol::reader &reader) -> bool {
+                (void) reader.read_int32(); // Skip schema version.
+
+                return reader.read_bool();
+            };
+
+            self->m_connection->perform_request<bool>(
+                client_operation::TUPLE_REPLACE, tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::replace_value_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &old_value,
+    const ignite_tuple &new_value, ignite_callback<bool> callback) {
+    with_latest_schema_async<bool>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), old_value = ignite_tuple(old_value),
+            new_value = ignite_tuple(new_value), tx0 = to_impl(tx)](const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &old_value, &new_value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, old_value);
+                write_tuple(writer, sch, key, new_value);
+            };
+
+            auto reader_func = [](protocol::reader &reader) -> bool {
+                (void) reader.read_int32(); // Skip schema version.
+
+                return reader.read_bool();
+            };
+
+            self->m_connection->perform_request<bool>(client_operation::TUPLE_REPLACE_EXACT, tx0.get(), writer_func,
+                std::move(reader_func), std::move(callback));
+        });
+}
+
+void table_impl::get_and_replace_value_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &value,
+    ignite_callback<std::optional<ignite_tuple>> callback) {
+
+    with_latest_schema_async<std::optional<ignite_tuple>>(std::move(callback),
+        [self = shared_from_this(), key = ignite_tuple(key), value = ignite_tuple(value), tx0 = to_impl(tx)](
+            const schema &sch, auto callback) mutable {
+            callback = self->invalidate_reads(sch, key, tx0.get(), std::move(callback));
+
+            auto writer_func = [self, &key, &value, &sch, &tx0](protocol::writer &writer) {
+                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                write_tuple(writer, sch, key, value);
+            };
+
+            auto reader_func = [self](protocol::reader &reader) -> std::optional<ignite_tuple> {
+                std::shared_ptr<schema> sch = self->get_schema(reader);
+
+                if (reader.try_read_nil())
+                    return std::nullopt;
+
+                return read_tuple(reader, std::move(sch), false);
+            };
+
+            self->m_connection->perform_request<std::optional<ignite_tuple>>(client_operation::TUPLE_GET_AND_REPLACE,
+                tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+        });
+}
+
 std::shared_ptr<table_impl> table_impl::from_facade(table &tb) {
     return tb.m_impl;
 }
@@ -18,14 +18,24 @@
 #pragma once
 
 #include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/table/near_cache.h"
+#include "ignite/client/detail/table/read_coalescer.h"
 #include "ignite/client/detail/table/schema.h"
+#include "ignite/client/detail/table/single_flight.h"
 #include "ignite/client/table/ignite_tuple.h"
+#include "ignite/client/table/near_cache_options.h"
+#include "ignite/client/table/near_cache_statistics.h"
+#include "ignite/client/table/read_coalescing_options.h"
 #include "ignite/client/transaction/transaction.h"
 #include "ignite/common/uuid.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ignite {
 class table;
@@ -38,6 +48,9 @@ namespace ignite::detail {
  */
 class table_impl : public std::enable_shared_from_this<table_impl> {
 public:
+    /** Server error code which means that the table does not exist (TABLE_ERR_GROUP, TABLE_NOT_FOUND_ERR). */
+    static constexpr std::int32_t TABLE_NOT_FOUND_ERROR_CODE = (2 << 16) | 2;
+
     // Deleted
     table_impl(table_impl &&) = delete;
     table_impl(const table_impl &) = delete;
@@ -77,7 +90,14 @@ public:
      */
     template<typename T>
     void with_latest_schema_async(
-        ignite_callback<T> handler, std::function<void(const schema &, ignite_callback<T>)> callback) {
+        ignite_callback<T> handler0, std::function<void(const schema &, ignite_callback<T>)> callback) {
+        ignite_callback<T> handler = [this, handler0 = std::move(handler0)](ignite_result<T> &&res) {
+            if (res.has_error() && is_table_not_found(res.error()))
+                m_dropped.store(true);
+
+            handler0(std::move(res));
+        };
+
         auto func = [this, handler = std::move(handler), callback = std::move(callback)](auto &&res) mutable {
             if (res.has_error()) {
                 handler(ignite_error{res.error()});
@@ -151,6 +171,19 @@ public:
      */
     void upsert_all_async(transaction *tx, std::vector<ignite_tuple> records, ignite_callback<void> callback);
 
+    /**
+     * Inserts multiple records into the table asynchronously, replacing existing ones.
+     *
+     * The records are shared, so the caller can send the same records again without copying them.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param records Records to upsert.
+     * @param callback Callback that is called on operation completion.
+     */
+    void upsert_all_async(transaction *tx, std::shared_ptr<const std::vector<ignite_tuple>> records,
+        ignite_callback<void> callback);
+
     /**
      * Inserts a record into the table and returns previous record asynchronously.
      *
@@ -288,6 +321,135 @@ public:
     void remove_all_exact_async(
         transaction *tx, std::vector<ignite_tuple> records, ignite_callback<std::vector<ignite_tuple>> callback);
 
+    /**
+     * Puts a value with a given key asynchronously.
+     *
+     * Key and value are encoded straight into a single record, key columns are taken from the key tuple and
+     * all the other columns are taken from the value tuple.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *  single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback.
+     */
+    void put_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<void> callback);
+
+    /**
+     * Puts multiple key-value pairs asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param pairs Pairs of key and value tuples.
+     * @param callback Callback that is called on operation completion.
+     */
+    void put_all_async(transaction *tx, std::vector<std::pair<ignite_tuple, ignite_tuple>> pairs,
+        ignite_callback<void> callback);
+
+    /**
+     * Puts multiple key-value pairs asynchronously.
+     *
+     * The pairs are shared, so the caller can send the same pairs again without copying them.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param pairs Pairs of key and value tuples.
+     * @param callback Callback that is called on operation completion.
+     */
+    void put_all_async(transaction *tx, std::shared_ptr<const std::vector<std::pair<ignite_tuple, ignite_tuple>>> pairs,
+        ignite_callback<void> callback);
+
+    /**
+     * Puts a value with a given key and returns the previous value asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback. Called with a value which contains replaced
+     *   record or @c std::nullopt if it did not exist.
+     */
+    void get_and_put_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &value,
+        ignite_callback<std::optional<ignite_tuple>> callback);
+
+    /**
+     * Puts a value with a given key if the key does not exist asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback. Called with a value indicating whether the
+     *   record was inserted.
+     */
+    void put_if_absent_async(
+        transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback);
+
+    /**
+     * Removes a record only if it has the specified key and value asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback that is called on operation completion. Called with
+     *   a value indicating whether a record with the specified key was deleted.
+     */
+    void remove_exact_async(
+        transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback);
+
+    /**
+     * Removes multiple exactly matching key-value pairs asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param pairs Pairs of key and value tuples.
+     * @param callback Callback that is called on operation completion. Called with
+     *   records that did not exist.
+     */
+    void remove_all_exact_async(transaction *tx, std::vector<std::pair<ignite_tuple, ignite_tuple>> pairs,
+        ignite_callback<std::vector<ignite_tuple>> callback);
+
+    /**
+     * Replaces a value with the specified key if it exists asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback. Called with a value indicating whether a record
+     *   with the specified key was replaced.
+     */
+    void replace_value_async(
+        transaction *tx, const ignite_tuple &key, const ignite_tuple &value, ignite_callback<bool> callback);
+
+    /**
+     * Replaces a value with the specified key only if the current value matches @c old_value asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param old_value Value expected to be associated with the key.
+     * @param new_value Value to replace it with.
+     * @param callback Callback. Called with a value indicating whether a
+     *   specified record was replaced.
+     */
+    void replace_value_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &old_value,
+        const ignite_tuple &new_value, ignite_callback<bool> callback);
+
+    /**
+     * Replaces a value with the specified key if it exists returning the previous value asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this
+     *   single operation is used.
+     * @param key Key.
+     * @param value Value.
+     * @param callback Callback. Called with a previous record for the given key,
+     *   or @c std::nullopt if it did not exist.
+     */
+    void get_and_replace_value_async(transaction *tx, const ignite_tuple &key, const ignite_tuple &value,
+        ignite_callback<std::optional<ignite_tuple>> callback);
+
     /**
      * Extract implementation from facade.
      *
@@ -303,7 +465,335 @@ public:
      */
     [[nodiscard]] uuid get_id() const { return m_id; }
 
+    /**
+     * Check whether the server reported that the table does not exist anymore.
+     * Dropped instances are evicted from the tables cache on the next lookup.
+     *
+     * @return @c true if the table was dropped.
+     */
+    [[nodiscard]] bool is_dropped() const { return m_dropped.load(); }
+
+    /**
+     * Check whether the error means that the table does not exist.
+     *
+     * @param err Error.
+     * @return @c true if the error is a table-not-found error.
+     */
+    [[nodiscard]] static bool is_table_not_found(const ignite_error &err) {
+        return std::int32_t(err.get_status_code()) == TABLE_NOT_FOUND_ERROR_CODE;
+    }
+
+    /**
+     * Enable the near cache, replacing the current one if any.
+     *
+     * @param options Near cache options.
+     */
+    void enable_near_cache(const near_cache_options &options) {
+        auto cache = std::make_shared<near_cache>(options);
+
+        std::lock_guard<std::mutex> lock(m_near_cache_mutex);
+        m_near_cache = std::move(cache);
+    }
+
+    /**
+     * Disable the near cache.
+     */
+    void disable_near_cache() {
+        std::lock_guard<std::mutex> lock(m_near_cache_mutex);
+        m_near_cache.reset();
+    }
+
+    /**
+     * Get near cache statistics.
+     *
+     * @return Statistics. All zeroes if the near cache is disabled.
+     */
+    [[nodiscard]] near_cache_statistics get_near_cache_statistics() const {
+        auto cache = get_near_cache();
+
+        return cache ? cache->get_statistics() : near_cache_statistics{};
+    }
+
+    /**
+     * Enable read coalescing, replacing the current settings if any.
+     *
+     * @param options Read coalescing options.
+     */
+    void enable_read_coalescing(const read_coalescing_options &options) {
+        auto sender = [weak_self = weak_from_this()](std::int32_t schema_version, std::vector<std::string> keys,
+                          ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
+            auto self = weak_self.lock();
+            if (!self) {
+                callback({ignite_error("Table is not available anymore")});
+                return;
+            }
+
+            self->get_all_encoded_async(schema_version, std::move(keys), std::move(callback));
+        };
+        auto coalescer = std::make_shared<read_coalescer>(options, std::move(sender));
+
+        std::lock_guard<std::mutex> lock(m_read_coalescer_mutex);
+        m_read_coalescer = std::move(coalescer);
+    }
+
+    /**
+     * Disable read coalescing.
+     */
+    void disable_read_coalescing() {
+        std::lock_guard<std::mutex> lock(m_read_coalescer_mutex);
+        m_read_coalescer.reset();
+    }
+
+    /**
+     * Enable deduplication of identical reads which are in flight at the same time.
+     */
+    void enable_read_deduplication() {
+        auto get_flights = std::make_shared<single_flight<std::optional<ignite_tuple>>>();
+        auto contains_flights = std::make_shared<single_flight<bool>>();
+
+        std::lock_guard<std::mutex> lock(m_read_flights_mutex);
+        if (!m_get_flights) {
+            m_get_flights = std::move(get_flights);
+            m_contains_flights = std::move(contains_flights);
+        }
+    }
+
+    /**
+     * Disable deduplication of identical reads.
+     */
+    void disable_read_deduplication() {
+        std::lock_guard<std::mutex> lock(m_read_flights_mutex);
+        m_get_flights.reset();
+        m_contains_flights.reset();
+    }
+
+    /**
+     * Get the number of reads which were attached to identical reads in flight.
+     *
+     * @return Number of deduplicated reads. Zero if deduplication is disabled.
+     */
+    [[nodiscard]] std::int64_t get_deduplicated_read_count() const {
+        std::lock_guard<std::mutex> lock(m_read_flights_mutex);
+        if (!m_get_flights)
+            return 0;
+
+        return m_get_flights->get_deduplicated() + m_contains_flights->get_deduplicated();
+    }
+
 private:
+    /**
+     * Gets a record by key asynchronously, without deduplication.
+     *
+     * @param tx Optional transaction.
+     * @param key Key.
+     * @param callback Callback.
+     */
+    void perform_get_async(
+        transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<ignite_tuple>> callback);
+
+    /**
+     * Determines if the table contains an entry for the specified key asynchronously, without deduplication.
+     *
+     * @param tx Optional transaction.
+     * @param key Key.
+     * @param callback Callback.
+     */
+    void perform_contains_async(transaction *tx, const ignite_tuple &key, ignite_callback<bool> callback);
+
+    /**
+     * Perform a read, attaching it to an identical read in flight if there is one.
+     *
+     * @param flights Reads in flight.
+     * @param key Key.
+     * @param callback Callback.
+     * @param perform Function performing the read.
+     */
+    template<typename T>
+    void perform_deduplicated_async(std::shared_ptr<single_flight<T>> flights, const ignite_tuple &key,
+        ignite_callback<T> callback,
+        void (table_impl::*perform)(transaction *, const ignite_tuple &, ignite_callback<T>)) {
+        with_latest_schema_async<T>(std::move(callback),
+            [self = shared_from_this(), key = ignite_tuple(key), flights = std::move(flights), perform](
+                const schema &sch, auto callback) {
+                // The key is encoded with the latest schema, so reads of different schema versions never match.
+                // Reads separated by a write never match either, so a read issued after a write sees it.
+                auto flight_key = std::to_string(sch.version) + ':' + std::to_string(self->m_write_generation.load())
+                    + ':' + encode_key(sch, key);
+                auto leader_callback = flights->join(flight_key, std::move(callback));
+                if (!leader_callback)
+                    return;
+
+                // The read can fail before it is sent. The flight is completed with the error then, so neither the
+                // attached reads nor the later ones wait for a response which never comes.
+                auto complete = *leader_callback;
+                auto res = result_of_operation<void>(
+                    [&] { ((*self).*perform)(nullptr, key, std::move(*leader_callback)); });
+
+                if (res.has_error())
+                    complete({std::move(res).error()});
+            });
+    }
+
+    /**
+     * Get the near cache.
+     *
+     * @return Near cache or @c nullptr if it is disabled.
+     */
+    [[nodiscard]] std::shared_ptr<near_cache> get_near_cache() const {
+        std::lock_guard<std::mutex> lock(m_near_cache_mutex);
+        return m_near_cache;
+    }
+
+    /**
+     * Gets multiple records by keys asynchronously, serving the cached ones from the near cache and requesting the
+     * rest from the server. The callback is called with a record for every key, in the order of the keys, and
+     * @c std::nullopt for the keys which do not exist.
+     *
+     * @param sch Latest schema.
+     * @param cache Near cache.
+     * @param keys Keys encoded with the schema.
+     * @param callback Callback.
+     */
+    void get_all_near_cache_async(const schema &sch, std::shared_ptr<near_cache> cache, std::vector<std::string> keys,
+        ignite_callback<std::vector<std::optional<ignite_tuple>>> callback);
+
+    /**
+     * Gets multiple records by keys which are already encoded asynchronously.
+     *
+     * Unlike get_all_async(), the callback is called with a record for every key, in the order of the keys, and
+     * @c std::nullopt for the keys which do not exist.
+     *
+     * @param schema_version Version of the schema the keys are encoded with.
+     * @param keys Encoded keys.
+     * @param callback Callback.
+     */
+    void get_all_encoded_async(std::int32_t schema_version, std::vector<std::string> keys,
+        ignite_callback<std::vector<std::optional<ignite_tuple>>> callback);
+
+    /**
+     * Gets a record by key asynchronously through the read coalescer.
+     *
+     * The key is encoded before it is handed to the coalescer, so a key which does not match the schema only fails
+     * its own read and not the whole batch.
+     *
+     * @param coalescer Read coalescer.
+     * @param key Key.
+     * @param callback Callback.
+     */
+    void coalesced_get_async(std::shared_ptr<read_coalescer> coalescer, const ignite_tuple &key,
+        ignite_callback<std::optional<ignite_tuple>> callback);
+
+    /**
+     * Get the read coalescer.
+     *
+     * @return Read coalescer or @c nullptr if read coalescing is disabled.
+     */
+    [[nodiscard]] std::shared_ptr<read_coalescer> get_read_coalescer() const {
+        std::lock_guard<std::mutex> lock(m_read_coalescer_mutex);
+        return m_read_coalescer;
+    }
+
+    /** Positions of the requested keys in a batch by their encoded key columns. */
+    typedef std::unordered_map<std::string, std::vector<std::size_t>> key_positions;
+
+    /**
+     * Read the records returned for a batch of keys and match them to the requested keys.
+     *
+     * The server only returns the records which exist, in no particular order, so every record is matched to the
+     * keys by its key columns, encoded with the same schema as the requested keys.
+     *
+     * @param reader Reader.
+     * @param sch Schema of the records.
+     * @param key_sch Schema the requested keys are encoded with.
+     * @param positions Positions of the requested keys.
+     * @param func Function called for every position of every returned record with the record data and the record.
+     */
+    static void read_matched_tuples(protocol::reader &reader, std::shared_ptr<schema> sch, const schema &key_sch,
+        const key_positions &positions, const std::function<void(std::size_t, bytes_view, ignite_tuple)> &func);
+
+    /**
+     * Encode key columns, to identify the key in the near cache and in the reads in flight.
+     *
+     * @param sch Schema.
+     * @param key Key or a record.
+     * @return Encoded key columns.
+     */
+    [[nodiscard]] static std::string encode_key(const schema &sch, const ignite_tuple &key);
+
+    /**
+     * Encode key columns of multiple keys.
+     *
+     * @param sch Schema.
+     * @param keys Keys or records.
+     * @return Encoded key columns.
+     */
+    [[nodiscard]] static std::vector<std::string> encode_keys(
+        const schema &sch, const std::vector<ignite_tuple> &keys);
+
+    /**
+     * Encode key columns of multiple keys.
+     *
+     * @param sch Schema.
+     * @param pairs Pairs of key and value tuples.
+     * @return Encoded key columns.
+     */
+    [[nodiscard]] static std::vector<std::string> encode_keys(
+        const schema &sch, const std::vector<std::pair<ignite_tuple, ignite_tuple>> &pairs);
+
+    /**
+     * Encode key columns of a single key.
+     *
+     * @param sch Schema.
+     * @param key Key or a record.
+     * @return Encoded key columns.
+     */
+    [[nodiscard]] static std::vector<std::string> encode_keys(const schema &sch, const ignite_tuple &key) {
+        return {encode_key(sch, key)};
+    }
+
+    /**
+     * Invalidate the reads of the written keys: near cache entries and reads in flight which may be shared.
+     *
+     * The near cache entries of the written keys are invalidated and the write generation is advanced now and once
+     * the write completes, so a read which overlaps with the write neither caches the old row nor is shared with
+     * reads issued after the write.
+     *
+     * Writes within a transaction only become visible to other readers when the transaction is committed, so the
+     * reads are invalidated when the transaction is finished instead.
+     *
+     * @param sch Schema.
+     * @param keys Written keys, records or pairs.
+     * @param tx Transaction or @c nullptr.
+     * @param callback Callback of the write.
+     * @return Callback to pass to the write.
+     */
+    template<typename T, typename K>
+    ignite_callback<T> invalidate_reads(
+        const schema &sch, const K &keys, transaction_impl *tx, ignite_callback<T> callback) {
+        auto cache = get_near_cache();
+        std::vector<std::string> encoded;
+        if (cache)
+            encoded = encode_keys(sch, keys);
+
+        auto invalidate = [self = shared_from_this(), cache = std::move(cache), encoded = std::move(encoded)] {
+            self->m_write_generation.fetch_add(1);
+            if (cache)
+                cache->invalidate(encoded);
+        };
+
+        if (tx) {
+            tx->add_finish_hook(std::move(invalidate));
+            return callback;
+        }
+
+        invalidate();
+
+        return [invalidate = std::move(invalidate), callback = std::move(callback)](ignite_result<T> &&res) {
+            invalidate();
+            callback(std::move(res));
+        };
+    }
+
     /**
      * Load latest schema from server asynchronously.
      *
@@ -374,6 +864,33 @@ private:
 
     /** Schemas. */
     std::unordered_map<int32_t, std::shared_ptr<schema>> m_schemas;
+
+    /** Dropped flag. */
+    std::atomic_bool m_dropped{false};
+
+    /** Near cache mutex. */
+    mutable std::mutex m_near_cache_mutex;
+
+    /** Near cache. */
+    std::shared_ptr<near_cache> m_near_cache;
+
+    /** Read coalescer mutex. */
+    mutable std::mutex m_read_coalescer_mutex;
+
+    /** Read coalescer. */
+    std::shared_ptr<read_coalescer> m_read_coalescer;
+
+    /** Reads in flight mutex. */
+    mutable std::mutex m_read_flights_mutex;
+
+    /** Get requests in flight. */
+    std::shared_ptr<single_flight<std::optional<ignite_tuple>>> m_get_flights;
+
+    /** Contains requests in flight. */
+    std::shared_ptr<single_flight<bool>> m_contains_flights;
+
+    /** Write generation. Advanced by every write, so reads in flight are not shared across writes. */
+    std::atomic<std::uint64_t> m_write_generation{0};
 };
 
 } // namespace ignite::detail
@@ -23,33 +23,71 @@
 namespace ignite::detail {
 
 void tables_impl::get_table_async(std::string_view name, ignite_callback<std::optional<table>> callback) {
+    get_table_impl_async(name, [callback = std::move(callback)](auto &&res) {
+        if (res.has_error()) {
+            callback({std::move(res.error())});
+            return;
+        }
+
+        auto impl = std::move(res).value();
+        if (!impl) {
+            callback(std::optional<table>{});
+            return;
+        }
+
+        callback(std::make_optional(table(std::move(impl))));
+    });
+}
+
+void tables_impl::get_table_impl_async(
+    std::string_view name, ignite_callback<std::shared_ptr<table_impl>> callback) {
+    auto key = normalize_name(name);
+    {
+        std::unique_lock<std::mutex> lock(m_tables_mutex);
+
+        auto it = m_tables.find(key);
+        if (it != m_tables.end()) {
+            if (!it->second->is_dropped()) {
+                auto cached = it->second;
+                lock.unlock();
+
+                callback(std::move(cached));
+                return;
+            }
+
+            m_tables.erase(it);
+        }
+    }
+
     auto writer_func = [&name](protocol::writer &writer) { writer.write(name); };
 
-    auto reader_func = [name, conn = m_connection](protocol::reader &reader) mutable -> std::optional<table> {
-        if (reader.try_read_nil())
-            return std::nullopt;
+    auto reader_func = [self = shared_from_this(), key, name = std::string(name)](
+                           protocol::reader &reader) mutable -> std::shared_ptr<table_impl> {
+        if (reader.try_read_nil()) {
+            self->invalidate_key(key);
+            return {};
+        }
 
         auto id = reader.read_uuid();
-        auto table0 = std::make_shared<table_impl>(std::string(name), id, std::move(conn));
-
-        return std::make_optional(table(table0));
+        return self->get_or_add(key, std::move(name), id);
     };
 
-    m_connection->perform_request<std::optional<table>>(
+    m_connection->perform_request<std::shared_ptr<table_impl>>(
         client_operation::TABLE_GET, writer_func, std::move(reader_func), std::move(callback));
 }
 
 void tables_impl::get_tables_async(ignite_callback<std::vector<table>> callback) {
-    auto reader_func = [conn = m_connection](protocol::reader &reader) -> std::vector<table> {
+    auto reader_func = [self = shared_from_this()](protocol::reader &reader) -> std::vector<table> {
         if (reader.try_read_nil())
             return {};
 
         std::vector<table> tables;
         tables.reserve(reader.read_map_size());
 
-        reader.read_map<uuid, std::string>([conn, &tables](auto &&id, auto &&name) {
-            auto table0 = std::make_shared<table_impl>(std::forward<std::string>(name), std::forward<uuid>(id), conn);
-            tables.push_back(table{table0});
+        reader.read_map<uuid, std::string>([&self, &tables](auto &&id, auto &&name) {
+            // Names returned by the server are already in the canonical form and can be used as a key as is.
+            auto key = std::string(name);
+            tables.push_back(table{self->get_or_add(key, std::forward<std::string>(name), id)});
         });
 
         return tables;
@@ -59,4 +97,49 @@ void tables_impl::get_tables_async(ignite_callback<std::vector<table>> callback)
         client_operation::TABLES_GET, std::move(reader_func), std::move(callback));
 }
 
+void tables_impl::invalidate(std::string_view name) {
+    invalidate_key(normalize_name(name));
+}
+
+void tables_impl::invalidate_key(const std::string &key) {
+    std::lock_guard<std::mutex> lock(m_tables_mutex);
+    m_tables.erase(key);
+}
+
+std::shared_ptr<table_impl> tables_impl::get_or_add(const std::string &key, std::string name, const uuid &id) {
+    std::lock_guard<std::mutex> lock(m_tables_mutex);
+
+    auto &cached = m_tables[key];
+    if (cached && cached->get_id() == id && !cached->is_dropped())
+        return cached;
+
+    // Table was dropped and re-created with the same name, or was not cached yet.
+    cached = std::make_shared<table_impl>(std::move(name), id, m_connection);
+    return cached;
+}
+
+std::string tables_impl::normalize_name(std::string_view name) {
+    if (name.size() >= 2 && name.front() == '"' && name.back() == '"') {
+        name = name.substr(1, name.size() - 2);
+
+        std::string res;
+        res.reserve(name.size());
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            res.push_back(name[i]);
+            // Escaped quote.
+            if (name[i] == '"' && i + 1 < name.size() && name[i + 1] == '"')
+                ++i;
+        }
+
+        return res;
+    }
+
+    std::string res;
+    res.reserve(name.size());
+    for (auto c : name)
+        res.push_back(char(std::toupper(static_cast<unsigned char>(c))));
+
+    return res;
+}
+
 } // namespace ignite::detail
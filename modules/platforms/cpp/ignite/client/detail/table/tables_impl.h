@@ -23,13 +23,19 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace ignite::detail {
 
 /**
  * Table management.
+ *
+ * Table instances are cached by normalized name, so the same @c table_impl (along with its schema cache) is shared by
+ * every @c table facade and by the compute API.
  */
-class tables_impl {
+class tables_impl : public std::enable_shared_from_this<tables_impl> {
 public:
     // Deleted
     tables_impl(tables_impl &&) = delete;
@@ -55,6 +61,23 @@ public:
      */
     void get_table_async(std::string_view name, ignite_callback<std::optional<table>> callback);
 
+    /**
+     * Gets a table implementation by name.
+     * Cached instance is returned if present, otherwise the table is requested from the cluster.
+     *
+     * @param name Table name.
+     * @param callback Callback. Called with @c nullptr if the table does not exist.
+     * @throw ignite_error In case of error while trying to send a request.
+     */
+    void get_table_impl_async(std::string_view name, ignite_callback<std::shared_ptr<table_impl>> callback);
+
+    /**
+     * Removes a table from the cache.
+     *
+     * @param name Table name.
+     */
+    void invalidate(std::string_view name);
+
     /**
      * Gets all tables.
      *
@@ -64,9 +87,41 @@ public:
      */
     void get_tables_async(ignite_callback<std::vector<table>> callback);
 
+    /**
+     * Normalize table name the same way the server does for a simple name: unquoted names are converted to upper case,
+     * quoted names are used as is, without quotes.
+     *
+     * @param name Table name.
+     * @return Normalized name.
+     */
+    [[nodiscard]] static std::string normalize_name(std::string_view name);
+
 private:
+    /**
+     * Removes a table from the cache by its normalized name.
+     *
+     * @param key Normalized table name.
+     */
+    void invalidate_key(const std::string &key);
+
+    /**
+     * Get cached table or create and cache a new one for the specified ID.
+     *
+     * @param key Normalized table name.
+     * @param name Table name.
+     * @param id Table ID.
+     * @return Table.
+     */
+    std::shared_ptr<table_impl> get_or_add(const std::string &key, std::string name, const uuid &id);
+
     /** Cluster connection. */
     std::shared_ptr<cluster_connection> m_connection;
+
+    /** Tables mutex. */
+    std::mutex m_tables_mutex;
+
+    /** Cached tables by normalized name. */
+    std::unordered_map<std::string, std::shared_ptr<table_impl>> m_tables;
 };
 
 } // namespace ignite::detail
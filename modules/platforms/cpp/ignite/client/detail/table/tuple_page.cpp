@@ -0,0 +1,67 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tuple_page.h"
+
+#include "ignite/client/detail/utils.h"
+
+namespace ignite::detail {
+
+tuple_page::tuple_page(std::shared_ptr<schema> sch, bool key_only)
+    : m_schema(std::move(sch))
+    , m_column_count(std::int32_t(key_only ? m_schema->key_column_count : m_schema->columns.size())) {}
+
+ignite_tuple tuple_page::add_row(bytes_view data) {
+    append_row(data);
+
+    return get_row(m_rows.size() - 1);
+}
+
+void tuple_page::append_row(bytes_view data) {
+    m_rows.emplace_back(m_data.size(), data.size());
+    m_data.insert(m_data.end(), data.begin(), data.end());
+}
+
+ignite_tuple tuple_page::get_row(std::size_t row) const {
+    return make_tuple(shared_from_this(), row);
+}
+
+std::int32_t tuple_page::column_ordinal(const std::string &parsed_name) const {
+    auto it = m_schema->ordinals.find(parsed_name);
+    if (it == m_schema->ordinals.end() || it->second >= m_column_count)
+        return -1;
+
+    return it->second;
+}
+
+binary_tuple_parser tuple_page::make_parser(std::size_t row) const {
+    auto [offset, size] = m_rows[row];
+
+    return binary_tuple_parser(m_column_count, bytes_view{m_data.data() + offset, size});
+}
+
+primitive tuple_page::get(std::size_t row, std::int32_t idx) const {
+    const auto &column = m_schema->columns[idx];
+
+    return read_column(make_parser(row).get(idx), column.type, column.scale);
+}
+
+std::optional<bytes_view> tuple_page::get_raw(std::size_t row, std::int32_t idx) const {
+    return make_parser(row).get(idx);
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,122 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/bytes_view.h"
+#include "ignite/tuple/binary_tuple_parser.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Rows of a single response, stored as binary tuples and decoded on demand.
+ *
+ * Row data of the whole response is kept in a single buffer, which is shared by all the tuples referencing the
+ * page, so string and byte array values can be accessed without copying.
+ */
+class tuple_page : public tuple_source, public std::enable_shared_from_this<tuple_page> {
+public:
+    /**
+     * Constructor.
+     *
+     * @param sch Schema of the rows.
+     * @param key_only Whether rows contain key columns only.
+     */
+    tuple_page(std::shared_ptr<schema> sch, bool key_only);
+
+    /**
+     * Add a row to the page. Rows can only be added before the values of the tuples backed by the page are accessed.
+     *
+     * @param data Row data encoded as a binary tuple.
+     * @return Tuple backed by the added row.
+     */
+    [[nodiscard]] ignite_tuple add_row(bytes_view data);
+
+    /**
+     * Append a row to the page without creating a tuple for it. Rows can only be added before the values of the
+     * tuples backed by the page are accessed.
+     *
+     * @param data Row data encoded as a binary tuple.
+     */
+    void append_row(bytes_view data);
+
+    /**
+     * Get a tuple backed by a row of the page.
+     *
+     * @param row The row index.
+     * @return Tuple.
+     */
+    [[nodiscard]] ignite_tuple get_row(std::size_t row) const;
+
+    [[nodiscard]] std::int32_t column_count() const override { return m_column_count; }
+
+    [[nodiscard]] const std::string &column_name(std::int32_t idx) const override {
+        return m_schema->columns[idx].name;
+    }
+
+    [[nodiscard]] ignite_type column_type(std::int32_t idx) const override { return m_schema->columns[idx].type; }
+
+    [[nodiscard]] std::int32_t column_ordinal(const std::string &parsed_name) const override;
+
+    [[nodiscard]] std::size_t shape_hash() const override {
+        return m_column_count == m_schema->key_column_count ? m_schema->key_shape_hash : m_schema->shape_hash;
+    }
+
+    [[nodiscard]] primitive get(std::size_t row, std::int32_t idx) const override;
+
+    [[nodiscard]] std::optional<bytes_view> get_raw(std::size_t row, std::int32_t idx) const override;
+
+    [[nodiscard]] std::size_t row_count() const override { return m_rows.size(); }
+
+    /**
+     * Get the size of the row data.
+     *
+     * @return Size of all the rows in bytes.
+     */
+    [[nodiscard]] std::size_t data_size() const { return m_data.size(); }
+
+    /**
+     * Make a parser of the row.
+     *
+     * @param row The row index.
+     * @return Parser.
+     */
+    [[nodiscard]] binary_tuple_parser make_parser(std::size_t row) const;
+
+private:
+
+    /** Schema. */
+    const std::shared_ptr<schema> m_schema;
+
+    /** Number of columns in every row. */
+    const std::int32_t m_column_count;
+
+    /** Data of all the rows. */
+    std::vector<std::byte> m_data;
+
+    /** Offset and size of every row in the data. */
+    std::vector<std::pair<std::size_t, std::size_t>> m_rows;
+};
+
+} // namespace ignite::detail
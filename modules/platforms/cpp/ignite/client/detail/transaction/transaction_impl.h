@@ -17,20 +17,43 @@
 
 #pragma once
 
+#include "ignite/client/detail/client_operation.h"
 #include "ignite/client/detail/node_connection.h"
+#include "ignite/client/detail/response_handler.h"
+#include "ignite/client/transaction/transaction_options.h"
 
+#include "ignite/common/bytes.h"
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_result.h"
+#include "ignite/common/uuid.h"
+#include "ignite/protocol/writer.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ignite::detail {
 
 /**
  * Ignite transaction implementation.
+ *
+ * The transaction is pinned to a single connection. TX_BEGIN is sent as soon as the transaction is created and the
+ * requests issued before its response arrives are serialized right away and queued, so the caller never waits for
+ * the begin round trip. The queue is flushed in order once the transaction ID is known.
+ *
+ * If write buffering is enabled, upserts are kept on the client and sent as a single TUPLE_UPSERT_ALL per table
+ * right before the next request of any other kind within the transaction, including commit. The requests issued
+ * after such a flush are queued until it completes, so they always observe the buffered writes.
  */
-class transaction_impl {
+class transaction_impl : public std::enable_shared_from_this<transaction_impl> {
 public:
     /** Transaction state. */
     enum class state {
@@ -51,22 +74,45 @@ public:
     /**
      * Constructor.
      *
-     * @param id Transaction ID.
      * @param connection Connection.
+     * @param options Transaction options.
      */
-    explicit transaction_impl(std::int64_t id, std::shared_ptr<node_connection> connection)
-        : m_id(id)
+    transaction_impl(std::shared_ptr<node_connection> connection, const transaction_options &options)
+        : m_read_only(options.read_only())
+        , m_deadline(options.timeout().count() > 0
+                  ? std::make_optional(std::chrono::steady_clock::now() + options.timeout())
+                  : std::nullopt)
+        , m_write_buffer_limit(options.read_only() ? 0 : options.write_buffer_limit())
         , m_state(state::OPEN)
         , m_connection(std::move(connection)) {}
 
     /**
      * Destructor.
      *
-     * It is important to rollback transaction synchronously on destruction to
-     * avoid conflicts if the same data is accessed after transaction is destructed.
+     * Rolls back the transaction if it was neither committed nor rolled back. The rollback request goes out on the
+     * same connection as all the transaction operations, so it is ordered after them and does not need to block.
      */
     ~transaction_impl() {
-        sync<void>([this](auto callback) { rollback_async(std::move(callback)); });
+        rollback_async([](ignite_result<void>) {});
+    }
+
+    /**
+     * Send TX_BEGIN request.
+     *
+     * @return @c true if the request was sent and @c false if the connection is closed.
+     */
+    bool start() {
+        auto writer_func = [read_only = m_read_only](protocol::writer &writer) { writer.write_bool(read_only); };
+
+        auto handler = std::make_shared<response_handler_reader<std::int64_t>>(
+            [](protocol::reader &reader) { return reader.read_int64(); },
+            [self = shared_from_this()](ignite_result<std::int64_t> &&res) { self->on_begin(std::move(res)); });
+
+        bool sent = m_connection->perform_request(client_operation::TX_BEGIN, writer_func, std::move(handler));
+        if (!sent)
+            set_state(state::ROLLED_BACK);
+
+        return sent;
     }
 
     /**
@@ -75,6 +121,12 @@ public:
      * @param callback Callback to be called upon asynchronous operation completion.
      */
     void commit_async(ignite_callback<void> callback) {
+        if (is_expired()) {
+            rollback_async([](ignite_result<void>) {});
+            callback(ignite_error("Transaction timed out and was rolled back"));
+            return;
+        }
+
         if (set_state(state::COMMITTED))
             finish(true, std::move(callback));
         else
@@ -94,11 +146,126 @@ public:
     }
 
     /**
-     * Get transaction ID.
+     * Perform request within the transaction.
+     *
+     * The request is sent immediately if the transaction ID is already known and there is no flush of buffered
+     * writes in progress. Otherwise, it is queued.
+     *
+     * @param op Operation code.
+     * @param wr Request writer function. Should use write_id() to write the transaction ID.
+     * @param handler Response handler.
+     * @return @c true on success and @c false if the connection is closed.
+     */
+    bool perform_request(client_operation op, const std::function<void(protocol::writer &)> &wr,
+        std::shared_ptr<response_handler> handler) {
+        if (op != client_operation::TX_COMMIT && op != client_operation::TX_ROLLBACK && is_expired()) {
+            rollback_async([](ignite_result<void>) {});
+            throw ignite_error("Transaction timed out and was rolled back");
+        }
+
+        std::vector<std::shared_ptr<response_handler>> failed;
+        std::optional<ignite_error> rejected;
+        bool sent = true;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            // A rollback is still needed if the transaction is started, but has failed afterwards.
+            if (m_error && (op != client_operation::TX_ROLLBACK || !m_id))
+                throw *m_error;
+
+            if (op == client_operation::TX_ROLLBACK)
+                m_write_buffers.clear();
+            else
+                flush_write_buffers(failed);
+
+            if (m_id && m_flushes_in_flight == 0 && m_pending.empty()) {
+                // The requests which could not be flushed are still failed below if this one is rejected.
+                try {
+                    sent = m_connection->perform_request(op, wr, std::move(handler));
+                } catch (ignite_error &err) {
+                    rejected = std::move(err);
+                }
+            } else {
+                m_id_offset.reset();
+                auto [req_id, message] = m_connection->make_request(op, wr);
+                m_pending.push_back({op, req_id, std::move(message), m_id_offset, std::move(handler), false});
+            }
+        }
+
+        fail_requests(failed);
+
+        if (rejected)
+            throw std::move(*rejected);
+
+        return sent;
+    }
+
+    /**
+     * Check whether the writes should be buffered on the client.
+     *
+     * @return @c true if write buffering is enabled.
+     */
+    [[nodiscard]] bool is_write_buffering_enabled() const { return m_write_buffer_limit > 0; }
+
+    /**
+     * Buffer upsert of a record.
+     *
+     * @param table_id Table ID.
+     * @param schema_version Version of the schema used to serialize the record.
+     * @param key Serialized key columns of the record. Only the latest write for every key is kept.
+     * @param record Serialized record.
+     */
+    void buffer_upsert(
+        const uuid &table_id, std::int32_t schema_version, std::vector<std::byte> key, std::vector<std::byte> record) {
+        if (is_expired()) {
+            rollback_async([](ignite_result<void>) {});
+            throw ignite_error("Transaction timed out and was rolled back");
+        }
+
+        std::vector<std::shared_ptr<response_handler>> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_error)
+                throw *m_error;
+
+            add_to_write_buffer(table_id, schema_version, std::move(key), std::move(record), failed);
+        }
+
+        fail_requests(failed);
+    }
+
+    /**
+     * Add a hook to be called when the transaction is finished: once when the commit or rollback is requested, and
+     * once again when it completes.
      *
-     * @return Transaction ID.
+     * @param hook Hook.
      */
-    [[nodiscard]] std::int64_t get_id() const { return m_id; }
+    void add_finish_hook(std::function<void()> hook) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finish_hooks.push_back(std::move(hook));
+    }
+
+    /**
+     * Write transaction ID.
+     *
+     * May only be called from the writer function passed to perform_request().
+     *
+     * @param writer Writer.
+     */
+    void write_id(protocol::writer &writer) {
+        if (m_id)
+            writer.write(*m_id);
+        else
+            m_id_offset = writer.reserve_int64();
+    }
+
+    /**
+     * Check whether the transaction is read-only.
+     *
+     * @return @c true if the transaction is read-only.
+     */
+    [[nodiscard]] bool is_read_only() const { return m_read_only; }
 
     /**
      * Get connection.
@@ -108,6 +275,260 @@ public:
     [[nodiscard]] std::shared_ptr<node_connection> get_connection() const { return m_connection; }
 
 private:
+    /**
+     * Request waiting to be sent.
+     */
+    struct pending_request {
+        /** Operation code. */
+        client_operation op;
+
+        /** Request ID. */
+        std::int64_t req_id;
+
+        /** Serialized message. */
+        std::vector<std::byte> message;
+
+        /** Offset of the transaction ID placeholder in the message. */
+        std::optional<std::size_t> id_offset;
+
+        /** Response handler. */
+        std::shared_ptr<response_handler> handler;
+
+        /** Flag indicating that the request flushes buffered writes. */
+        bool flush;
+    };
+
+    /**
+     * Buffered writes of a single table.
+     */
+    struct write_buffer {
+        /** Table ID. */
+        uuid table_id;
+
+        /** Schema version. */
+        std::int32_t schema_version;
+
+        /** Serialized records. */
+        std::vector<std::vector<std::byte>> records;
+
+        /** Record index by serialized key. */
+        std::unordered_map<std::string, std::size_t> index;
+    };
+
+    /**
+     * Add record to the write buffer of the table. Should be called with the mutex held.
+     *
+     * @param table_id Table ID.
+     * @param schema_version Version of the schema used to serialize the record.
+     * @param key Serialized key columns of the record.
+     * @param record Serialized record.
+     * @param failed Handlers of the requests which could not be sent.
+     */
+    void add_to_write_buffer(const uuid &table_id, std::int32_t schema_version, std::vector<std::byte> key,
+        std::vector<std::byte> record, std::vector<std::shared_ptr<response_handler>> &failed) {
+        auto it = std::find_if(m_write_buffers.begin(), m_write_buffers.end(),
+            [&table_id](const write_buffer &buffer) { return buffer.table_id == table_id; });
+
+        // Records serialized with different schema versions can not be sent in the same request.
+        if (it != m_write_buffers.end() && it->schema_version != schema_version) {
+            flush_write_buffers(failed);
+            it = m_write_buffers.end();
+        }
+
+        if (it == m_write_buffers.end()) {
+            m_write_buffers.push_back({table_id, schema_version, {}, {}});
+            it = std::prev(m_write_buffers.end());
+        }
+
+        std::string key_str(reinterpret_cast<const char *>(key.data()), key.size());
+        auto [idx_it, inserted] = it->index.emplace(std::move(key_str), it->records.size());
+        if (inserted)
+            it->records.push_back(std::move(record));
+        else
+            it->records[idx_it->second] = std::move(record);
+
+        if (it->records.size() >= m_write_buffer_limit)
+            flush_write_buffers(failed);
+    }
+
+    /**
+     * Send all the buffered writes. Should be called with the mutex held.
+     *
+     * @param failed Handlers of the requests which could not be sent.
+     */
+    void flush_write_buffers(std::vector<std::shared_ptr<response_handler>> &failed) {
+        for (auto &buffer : m_write_buffers) {
+            auto writer_func = [this, &buffer](protocol::writer &writer) {
+                writer.write(buffer.table_id);
+                write_id(writer);
+                writer.write(buffer.schema_version);
+                writer.write(std::int32_t(buffer.records.size()));
+                for (const auto &record : buffer.records)
+                    writer.write_raw(record);
+            };
+
+            auto handler = std::make_shared<response_handler_reader<void>>([](protocol::reader &) {},
+                [self = shared_from_this()](ignite_result<void> &&res) { self->on_flush(std::move(res)); });
+
+            m_id_offset.reset();
+            auto [req_id, message] = m_connection->make_request(client_operation::TUPLE_UPSERT_ALL, writer_func);
+            m_pending.push_back({client_operation::TUPLE_UPSERT_ALL, req_id, std::move(message), m_id_offset,
+                std::move(handler), true});
+        }
+        m_write_buffers.clear();
+
+        send_pending(failed);
+    }
+
+    /**
+     * Send queued requests up to and including the next flush of buffered writes. Should be called with the mutex
+     * held.
+     *
+     * @param failed Handlers of the requests which could not be sent.
+     */
+    void send_pending(std::vector<std::shared_ptr<response_handler>> &failed) {
+        while (m_id && m_flushes_in_flight == 0 && !m_pending.empty()) {
+            auto &req = m_pending.front();
+            if (req.id_offset)
+                bytes::store<endian::BIG>(req.message.data() + *req.id_offset, *m_id);
+
+            bool sent = false;
+            try {
+                sent = m_connection->send_request(req.op, req.req_id, std::move(req.message), req.handler);
+            } catch (ignite_error &err) {
+                // Rejected by the concurrency limit. The queued requests can not be sent out of order, so the
+                // transaction fails, and is rolled back if it was being committed.
+                m_error = std::move(err);
+                if (drop_pending(failed, false))
+                    queue_rollback();
+
+                continue;
+            }
+
+            if (!sent) {
+                m_error = ignite_error("Connection associated with the transaction is closed");
+                (void) drop_pending(failed, false);
+                return;
+            }
+
+            if (req.flush)
+                ++m_flushes_in_flight;
+
+            m_pending.pop_front();
+        }
+    }
+
+    /**
+     * Drop the queued requests. Should be called with the mutex held.
+     *
+     * @param failed Handlers of the dropped requests.
+     * @param keep_rollback Whether the queued rollbacks should be kept to be sent once the transaction ID is known
+     *  and the flushes in flight are completed.
+     * @return @c true if a commit was dropped.
+     */
+    [[nodiscard]] bool drop_pending(std::vector<std::shared_ptr<response_handler>> &failed, bool keep_rollback) {
+        bool commit_dropped = false;
+        std::deque<pending_request> kept;
+        for (auto &req : m_pending) {
+            if (keep_rollback && req.op == client_operation::TX_ROLLBACK) {
+                kept.push_back(std::move(req));
+                continue;
+            }
+
+            commit_dropped |= req.op == client_operation::TX_COMMIT;
+
+            // Flushes are internal requests, it is enough to fail the requests queued behind them.
+            if (!req.flush)
+                failed.push_back(std::move(req.handler));
+        }
+        m_pending = std::move(kept);
+
+        return commit_dropped;
+    }
+
+    /**
+     * Queue rollback of the transaction which was committed, but failed before the commit was sent, so that it does
+     * not stay open on the server. Should be called with the mutex held, once the transaction ID is known.
+     */
+    void queue_rollback() {
+        auto writer_func = [this](protocol::writer &writer) { writer.write(*m_id); };
+
+        auto handler =
+            std::make_shared<response_handler_reader<void>>([](protocol::reader &) {}, [](ignite_result<void> &&) {});
+
+        auto [req_id, message] = m_connection->make_request(client_operation::TX_ROLLBACK, writer_func);
+        m_pending.push_back(
+            {client_operation::TX_ROLLBACK, req_id, std::move(message), std::nullopt, std::move(handler), false});
+    }
+
+    /**
+     * Handle TX_BEGIN response.
+     *
+     * @param res Transaction ID or error.
+     */
+    void on_begin(ignite_result<std::int64_t> &&res) {
+        std::vector<std::shared_ptr<response_handler>> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (res.has_error()) {
+                // Nothing to roll back, the transaction is not started.
+                m_error = res.error();
+                (void) drop_pending(failed, false);
+            } else {
+                m_id = res.value();
+                send_pending(failed);
+            }
+        }
+
+        fail_requests(failed);
+    }
+
+    /**
+     * Handle response to the flush of buffered writes.
+     *
+     * @param res Result.
+     */
+    void on_flush(ignite_result<void> &&res) {
+        std::vector<std::shared_ptr<response_handler>> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            --m_flushes_in_flight;
+            if (res.has_error()) {
+                m_error = ignite_error(
+                    res.error().get_status_code(), "Failed to flush buffered writes: " + res.error().what_str());
+
+                if (drop_pending(failed, true))
+                    queue_rollback();
+            }
+
+            send_pending(failed);
+        }
+
+        fail_requests(failed);
+    }
+
+    /**
+     * Complete the requests which could not be sent with the transaction error.
+     *
+     * @param failed Handlers of the failed requests.
+     */
+    void fail_requests(const std::vector<std::shared_ptr<response_handler>> &failed) {
+        if (failed.empty())
+            return;
+
+        ignite_error err("Transaction failed");
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_error)
+                err = *m_error;
+        }
+
+        for (const auto &handler : failed)
+            (void) handler->set_error(err);
+    }
+
     /**
      * Perform operation.
      *
@@ -115,10 +536,70 @@ private:
      * @param callback Callback to be called upon asynchronous operation completion.
      */
     void finish(bool commit, ignite_callback<void> callback) {
-        auto writer_func = [id = m_id](protocol::writer &writer) { writer.write(id); };
+        std::vector<std::function<void()>> hooks;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            hooks.swap(m_finish_hooks);
+        }
+
+        if (!hooks.empty()) {
+            for (const auto &hook : hooks)
+                hook();
+
+            callback = [hooks = std::move(hooks), callback = std::move(callback)](ignite_result<void> &&res) {
+                for (const auto &hook : hooks)
+                    hook();
+
+                callback(std::move(res));
+            };
+        }
+
+        auto writer_func = [this](protocol::writer &writer) { write_id(writer); };
 
-        m_connection->perform_request_wr<void>(
-            commit ? client_operation::TX_COMMIT : client_operation::TX_ROLLBACK, writer_func, std::move(callback));
+        auto handler = std::make_shared<response_handler_reader<void>>([](protocol::reader &) {}, callback);
+
+        auto res = result_of_operation<bool>([&]() {
+            return perform_request(
+                commit ? client_operation::TX_COMMIT : client_operation::TX_ROLLBACK, writer_func, handler);
+        });
+
+        if (res.has_error()) {
+            // Nothing to roll back if the transaction has never started.
+            if (commit) {
+                rollback_failed();
+                callback(std::move(res.error()));
+            } else
+                callback({});
+        } else if (!res.value()) {
+            callback(ignite_error("Connection associated with the transaction is closed"));
+        }
+    }
+
+    /**
+     * Roll back the transaction which failed before it was committed, if it is started.
+     */
+    void rollback_failed() {
+        std::vector<std::shared_ptr<response_handler>> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_id || !m_error)
+                return;
+
+            queue_rollback();
+            send_pending(failed);
+        }
+
+        fail_requests(failed);
+    }
+
+    /**
+     * Check whether the transaction timeout is expired.
+     *
+     * @return @c true if the timeout is set and expired.
+     */
+    [[nodiscard]] bool is_expired() const {
+        return m_deadline && std::chrono::steady_clock::now() >= *m_deadline;
     }
 
     /**
@@ -132,8 +613,38 @@ private:
         return m_state.compare_exchange_strong(old, st, std::memory_order_relaxed);
     }
 
-    /** ID. */
-    std::int64_t m_id;
+    /** Read-only flag. */
+    const bool m_read_only;
+
+    /** Point in time after which the transaction is rolled back. */
+    const std::optional<std::chrono::steady_clock::time_point> m_deadline;
+
+    /** Maximum number of buffered writes per table. Zero means that the writes are not buffered. */
+    const std::size_t m_write_buffer_limit;
+
+    /** ID. Set once the TX_BEGIN response is received. */
+    std::optional<std::int64_t> m_id;
+
+    /** Error which made the transaction unusable. */
+    std::optional<ignite_error> m_error;
+
+    /** Offset of the transaction ID placeholder in the request being serialized. */
+    std::optional<std::size_t> m_id_offset;
+
+    /** Requests waiting for the transaction ID or for the flush of buffered writes. */
+    std::deque<pending_request> m_pending;
+
+    /** Number of sent flushes of buffered writes which are not completed yet. */
+    std::int32_t m_flushes_in_flight{0};
+
+    /** Buffered writes. */
+    std::vector<write_buffer> m_write_buffers;
+
+    /** Hooks to be called when the transaction is finished. */
+    std::vector<std::function<void()>> m_finish_hooks;
+
+    /** Mutex. */
+    std::mutex m_mutex;
 
     /** State. */
     std::atomic<state> m_state{state::OPEN};
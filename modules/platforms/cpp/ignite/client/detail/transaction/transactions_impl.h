@@ -19,6 +19,7 @@
 
 #include "ignite/client/detail/cluster_connection.h"
 #include "ignite/client/detail/transaction/transaction_impl.h"
+#include "ignite/client/transaction/transaction_options.h"
 
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_result.h"
@@ -52,21 +53,24 @@ public:
     /**
      * Starts a new transaction asynchronously.
      *
+     * The transaction is returned without waiting for the TX_BEGIN response. Its operations are sent over the same
+     * connection right behind TX_BEGIN.
+     *
+     * @param options Transaction options.
      * @param callback Callback to be called with a new transaction or error upon completion of asynchronous operation.
      */
-    IGNITE_API void begin_async(ignite_callback<transaction> callback) {
-        auto writer_func = [](protocol::writer &writer) {
-            writer.write_bool(false); // readOnly.
-        };
-
-        auto reader_func = [](protocol::reader &reader, std::shared_ptr<node_connection> conn) mutable -> transaction {
-            auto id = reader.read_int64();
-
-            return transaction(std::make_shared<transaction_impl>(id, std::move(conn)));
-        };
+    IGNITE_API void begin_async(const transaction_options &options, ignite_callback<transaction> callback) {
+        while (true) {
+            auto channel = m_connection->get_random_channel();
+            if (!channel)
+                throw ignite_error("No nodes connected");
 
-        m_connection->perform_request<transaction>(
-            client_operation::TX_BEGIN, std::move(writer_func), std::move(reader_func), std::move(callback));
+            auto impl = std::make_shared<transaction_impl>(std::move(channel), options);
+            if (impl->start()) {
+                callback(transaction(std::move(impl)));
+                return;
+            }
+        }
     }
 
 private:
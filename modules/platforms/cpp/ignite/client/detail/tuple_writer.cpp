@@ -0,0 +1,110 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/tuple_writer.h"
+
+#include "ignite/tuple/binary_tuple_builder.h"
+
+namespace ignite::detail {
+
+void tuple_writer::append_null() {
+    m_builder.append(std::nullopt);
+}
+
+void tuple_writer::append_bool(bool value) {
+    m_builder.append_bool(value);
+}
+
+void tuple_writer::append_int8(std::int8_t value) {
+    m_builder.append_int8(value);
+}
+
+void tuple_writer::append_int16(std::int16_t value) {
+    m_builder.append_int16(value);
+}
+
+void tuple_writer::append_int32(std::int32_t value) {
+    m_builder.append_int32(value);
+}
+
+void tuple_writer::append_int64(std::int64_t value) {
+    m_builder.append_int64(value);
+}
+
+void tuple_writer::append_float(float value) {
+    m_builder.append_float(value);
+}
+
+void tuple_writer::append_double(double value) {
+    m_builder.append_double(value);
+}
+
+void tuple_writer::append_uuid(uuid value) {
+    m_builder.append_uuid(value);
+}
+
+void tuple_writer::append_string(std::string_view value) {
+    m_builder.append_bytes(value);
+}
+
+void tuple_writer::append_bytes(bytes_view value) {
+    m_builder.append_bytes(value);
+}
+
+void tuple_writer::append_number(const big_integer &value) {
+    m_builder.append_number(value);
+}
+
+void tuple_writer::append_number(const big_decimal &value) {
+    m_builder.append_number(value);
+}
+
+void tuple_writer::append_decimal(const big_decimal &value, std::int32_t scale) {
+    big_decimal to_write;
+    value.set_scale(scale, to_write);
+    m_builder.append_number(to_write);
+}
+
+void tuple_writer::append_date(const ignite_date &value) {
+    m_builder.append_date(value);
+}
+
+void tuple_writer::append_time(const ignite_time &value) {
+    m_builder.append_time(value);
+}
+
+void tuple_writer::append_date_time(const ignite_date_time &value) {
+    m_builder.append_date_time(value);
+}
+
+void tuple_writer::append_timestamp(const ignite_timestamp &value) {
+    m_builder.append_timestamp(value);
+}
+
+void tuple_writer::append_period(const ignite_period &value) {
+    m_builder.append_period(value);
+}
+
+void tuple_writer::append_duration(const ignite_duration &value) {
+    m_builder.append_duration(value);
+}
+
+void tuple_writer::append_bit_array(const bit_array &value) {
+    m_builder.append_bytes(value.get_raw());
+}
+
+} // namespace ignite::detail
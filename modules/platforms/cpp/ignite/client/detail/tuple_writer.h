@@ -0,0 +1,210 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/common/big_decimal.h"
+#include "ignite/common/big_integer.h"
+#include "ignite/common/bit_array.h"
+#include "ignite/common/bytes_view.h"
+#include "ignite/common/config.h"
+#include "ignite/common/ignite_date.h"
+#include "ignite/common/ignite_date_time.h"
+#include "ignite/common/ignite_duration.h"
+#include "ignite/common/ignite_period.h"
+#include "ignite/common/ignite_time.h"
+#include "ignite/common/ignite_timestamp.h"
+#include "ignite/common/uuid.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace ignite {
+class binary_tuple_builder;
+} // namespace ignite
+
+namespace ignite::detail {
+
+/**
+ * Writer of binary tuple elements.
+ *
+ * Exposes the tuple builder of the client library to the code generated in user translation units, so the values
+ * of mapped types and typed arguments are written straight into binary tuples, while the encoding itself stays in
+ * the library.
+ */
+class tuple_writer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param builder Tuple builder. Should be in the single-pass mode.
+     */
+    explicit tuple_writer(binary_tuple_builder &builder)
+        : m_builder(builder) {}
+
+    /**
+     * Append null.
+     */
+    IGNITE_API void append_null();
+
+    /**
+     * Append boolean.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_bool(bool value);
+
+    /**
+     * Append 8-bit integer.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_int8(std::int8_t value);
+
+    /**
+     * Append 16-bit integer.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_int16(std::int16_t value);
+
+    /**
+     * Append 32-bit integer.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_int32(std::int32_t value);
+
+    /**
+     * Append 64-bit integer.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_int64(std::int64_t value);
+
+    /**
+     * Append float.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_float(float value);
+
+    /**
+     * Append double.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_double(double value);
+
+    /**
+     * Append UUID.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_uuid(uuid value);
+
+    /**
+     * Append string.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_string(std::string_view value);
+
+    /**
+     * Append byte array.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_bytes(bytes_view value);
+
+    /**
+     * Append big integer.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_number(const big_integer &value);
+
+    /**
+     * Append decimal with its own scale.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_number(const big_decimal &value);
+
+    /**
+     * Append decimal rescaled to the column scale.
+     *
+     * @param value Value.
+     * @param scale Column scale.
+     */
+    IGNITE_API void append_decimal(const big_decimal &value, std::int32_t scale);
+
+    /**
+     * Append date.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_date(const ignite_date &value);
+
+    /**
+     * Append time.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_time(const ignite_time &value);
+
+    /**
+     * Append date time.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_date_time(const ignite_date_time &value);
+
+    /**
+     * Append timestamp.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_timestamp(const ignite_timestamp &value);
+
+    /**
+     * Append period.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_period(const ignite_period &value);
+
+    /**
+     * Append duration.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_duration(const ignite_duration &value);
+
+    /**
+     * Append bit array.
+     *
+     * @param value Value.
+     */
+    IGNITE_API void append_bit_array(const bit_array &value);
+
+private:
+    /** Tuple builder. */
+    binary_tuple_builder &m_builder;
+};
+
+} // namespace ignite::detail
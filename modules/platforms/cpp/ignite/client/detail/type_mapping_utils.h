@@ -30,13 +30,31 @@ namespace ignite {
  */
 template<typename T>
 std::vector<ignite_tuple> values_to_tuples(std::vector<T> values) {
-    //TODO: Optimize memory usage (IGNITE-19198)
-    std::vector<ignite_tuple> tuples;
-    tuples.reserve(values.size());
-    for (auto &&value : std::move(values)) {
-        tuples.push_back(convert_to_tuple(std::move(value)));
+    if constexpr (struct_mapping<T>::mapped) {
+        return detail::struct_source<T>::to_tuples(std::move(values));
+    } else {
+        //TODO: Optimize memory usage (IGNITE-19198)
+        std::vector<ignite_tuple> tuples;
+        tuples.reserve(values.size());
+        for (auto &&value : std::move(values)) {
+            tuples.push_back(convert_to_tuple(std::move(value)));
+        }
+        return tuples;
     }
-    return tuples;
+}
+
+/**
+ * Convert a value to a tuple.
+ * @param value Value.
+ * @return Tuple.
+ */
+template<typename T>
+ignite_tuple value_to_tuple(T &&value) {
+    typedef typename std::decay<T>::type value_type;
+    if constexpr (struct_mapping<value_type>::mapped)
+        return detail::struct_source<value_type>::to_tuple(std::forward<T>(value));
+    else
+        return convert_to_tuple(std::forward<T>(value));
 }
 
 /**
@@ -50,7 +68,7 @@ std::vector<std::pair<ignite_tuple, ignite_tuple>> values_to_tuples(std::vector<
     std::vector<std::pair<ignite_tuple, ignite_tuple>> tuples;
     tuples.reserve(values.size());
     for (auto &&pair : std::move(values)) {
-        tuples.emplace_back(convert_to_tuple(std::move(pair.first)), convert_to_tuple(std::move(pair.second)));
+        tuples.emplace_back(value_to_tuple(std::move(pair.first)), value_to_tuple(std::move(pair.second)));
     }
     return tuples;
 }
@@ -65,8 +83,15 @@ std::vector<T> tuples_to_values(std::vector<ignite_tuple> tuples) {
     //TODO: Optimize memory usage (IGNITE-19198)
     std::vector<T> values;
     values.reserve(tuples.size());
-    for (auto &&tuple : std::move(tuples)) {
-        values.emplace_back(convert_from_tuple<T>(std::move(tuple)));
+    if constexpr (struct_mapping<T>::mapped) {
+        typename detail::struct_source<T>::decoder decoder;
+        for (const auto &tuple : tuples) {
+            values.emplace_back(decoder.decode(tuple));
+        }
+    } else {
+        for (auto &&tuple : std::move(tuples)) {
+            values.emplace_back(convert_from_tuple<T>(std::move(tuple)));
+        }
     }
     return values;
 }
@@ -81,8 +106,18 @@ std::vector<std::optional<T>> tuples_to_values(std::vector<std::optional<ignite_
     //TODO: Optimize memory usage (IGNITE-19198)
     std::vector<std::optional<T>> values;
     values.reserve(tuples.size());
-    for (auto &&tuple : std::move(tuples)) {
-        values.emplace_back(convert_from_tuple<T>(std::move(tuple)));
+    if constexpr (struct_mapping<T>::mapped) {
+        typename detail::struct_source<T>::decoder decoder;
+        for (const auto &tuple : tuples) {
+            if (tuple)
+                values.emplace_back(decoder.decode(*tuple));
+            else
+                values.emplace_back(std::nullopt);
+        }
+    } else {
+        for (auto &&tuple : std::move(tuples)) {
+            values.emplace_back(convert_from_tuple<T>(std::move(tuple)));
+        }
     }
     return values;
 }
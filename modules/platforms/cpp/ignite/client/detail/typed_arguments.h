@@ -0,0 +1,210 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/client/detail/struct_source.h>
+#include <ignite/client/detail/tuple_writer.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Get the type used to pass an argument of the C++ type to the server.
+ *
+ * @tparam T Argument type.
+ * @return Argument type, or @c ignite_type::UNDEFINED if the type is not supported or is @c std::nullopt_t.
+ */
+template<typename T>
+constexpr ignite_type argument_type_of() {
+    typedef typename remove_optional<T>::type V;
+
+    if constexpr (std::is_same_v<V, bool>)
+        return ignite_type::INT8; // Booleans are passed as INT8, the same way as the primitive arguments.
+    else if constexpr (std::is_integral_v<V> && std::is_signed_v<V> && !std::is_same_v<V, char>) {
+        if constexpr (sizeof(V) == 1)
+            return ignite_type::INT8;
+        else if constexpr (sizeof(V) == 2)
+            return ignite_type::INT16;
+        else if constexpr (sizeof(V) == 4)
+            return ignite_type::INT32;
+        else
+            return ignite_type::INT64;
+    } else if constexpr (std::is_same_v<V, float>)
+        return ignite_type::FLOAT;
+    else if constexpr (std::is_same_v<V, double>)
+        return ignite_type::DOUBLE;
+    else if constexpr (std::is_same_v<V, uuid>)
+        return ignite_type::UUID;
+    else if constexpr (std::is_same_v<V, std::string> || std::is_same_v<V, std::string_view>
+        || std::is_same_v<V, const char *>)
+        return ignite_type::STRING;
+    else if constexpr (std::is_same_v<V, std::vector<std::byte>>)
+        return ignite_type::BYTE_ARRAY;
+    else if constexpr (std::is_same_v<V, big_decimal>)
+        return ignite_type::DECIMAL;
+    else if constexpr (std::is_same_v<V, big_integer>)
+        return ignite_type::NUMBER;
+    else if constexpr (std::is_same_v<V, ignite_date>)
+        return ignite_type::DATE;
+    else if constexpr (std::is_same_v<V, ignite_time>)
+        return ignite_type::TIME;
+    else if constexpr (std::is_same_v<V, ignite_date_time>)
+        return ignite_type::DATETIME;
+    else if constexpr (std::is_same_v<V, ignite_timestamp>)
+        return ignite_type::TIMESTAMP;
+    else if constexpr (std::is_same_v<V, ignite_period>)
+        return ignite_type::PERIOD;
+    else if constexpr (std::is_same_v<V, ignite_duration>)
+        return ignite_type::DURATION;
+    else
+        return ignite_type::UNDEFINED;
+}
+
+/**
+ * Get the type an argument is encoded as: string literals and character arrays are encoded as C strings.
+ */
+template<typename T>
+using argument_t = std::conditional_t<std::is_same_v<std::decay_t<T>, char *>, const char *, std::decay_t<T>>;
+
+/**
+ * Check whether values of all the types can be passed as typed arguments.
+ */
+template<typename... Ts>
+inline constexpr bool are_arguments_v = ((std::is_same_v<argument_t<Ts>, std::nullopt_t>
+                                             || argument_type_of<argument_t<Ts>>() != ignite_type::UNDEFINED)
+    && ...);
+
+/**
+ * Typed arguments, encoded by the client library straight into the request as a binary tuple of type, scale and
+ * value triples.
+ *
+ * Refers to the argument values, so it can only be used while they exist. Requests are serialized before the
+ * operation call returns, so the arguments passed to it are always alive at that point.
+ */
+struct typed_arguments {
+    /** Number of arguments. */
+    std::int32_t count{0};
+
+    /** Function appending the argument values to tuple writer. */
+    void (*append)(tuple_writer &writer, const void *values){nullptr};
+
+    /** Argument values passed to the append function. */
+    const void *values{nullptr};
+};
+
+/**
+ * Append the argument with type header in tuple writer.
+ *
+ * @param writer Tuple writer.
+ * @param value Value.
+ */
+template<typename T>
+void append_argument(tuple_writer &writer, const T &value) {
+    constexpr auto typ = argument_type_of<T>();
+
+    if constexpr (std::is_same_v<T, std::nullopt_t>) {
+        writer.append_null(); // Type.
+        writer.append_null(); // Scale.
+        writer.append_null(); // Value.
+    } else if constexpr (is_optional<T>::value) {
+        if (value) {
+            append_argument(writer, *value);
+        } else {
+            append_argument(writer, std::nullopt);
+        }
+    } else {
+        writer.append_int32(std::int32_t(typ));
+        if constexpr (typ == ignite_type::DECIMAL)
+            writer.append_int32(value.get_scale());
+        else
+            writer.append_int32(0);
+
+        if constexpr (std::is_same_v<T, bool>)
+            writer.append_int8(value ? 1 : 0);
+        else if constexpr (typ == ignite_type::INT8)
+            writer.append_int8(value);
+        else if constexpr (typ == ignite_type::INT16)
+            writer.append_int16(value);
+        else if constexpr (typ == ignite_type::INT32)
+            writer.append_int32(value);
+        else if constexpr (typ == ignite_type::INT64)
+            writer.append_int64(value);
+        else if constexpr (typ == ignite_type::FLOAT)
+            writer.append_float(value);
+        else if constexpr (typ == ignite_type::DOUBLE)
+            writer.append_double(value);
+        else if constexpr (typ == ignite_type::UUID)
+            writer.append_uuid(value);
+        else if constexpr (typ == ignite_type::STRING)
+            writer.append_string(std::string_view(value));
+        else if constexpr (typ == ignite_type::BYTE_ARRAY)
+            writer.append_bytes(value);
+        else if constexpr (typ == ignite_type::DECIMAL || typ == ignite_type::NUMBER)
+            writer.append_number(value);
+        else if constexpr (typ == ignite_type::DATE)
+            writer.append_date(value);
+        else if constexpr (typ == ignite_type::TIME)
+            writer.append_time(value);
+        else if constexpr (typ == ignite_type::DATETIME)
+            writer.append_date_time(value);
+        else if constexpr (typ == ignite_type::TIMESTAMP)
+            writer.append_timestamp(value);
+        else if constexpr (typ == ignite_type::PERIOD)
+            writer.append_period(value);
+        else if constexpr (typ == ignite_type::DURATION)
+            writer.append_duration(value);
+        else
+            static_assert(sizeof(T) == 0, "Argument type is not supported");
+    }
+}
+
+/**
+ * Append the arguments stored in a tuple to tuple writer.
+ *
+ * @tparam Tuple Type of the tuple holding the arguments.
+ * @tparam Args Argument types.
+ * @param writer Tuple writer.
+ * @param values Pointer to the tuple holding the arguments.
+ */
+template<typename Tuple, typename... Args>
+void append_arguments(tuple_writer &writer, const void *values) {
+    std::apply([&writer](const auto &...args) { (append_argument<argument_t<Args>>(writer, args), ...); },
+        *static_cast<const Tuple *>(values));
+}
+
+/**
+ * Make typed arguments referring to the values of the tuple.
+ *
+ * @param values Arguments, e.g. made with @c std::forward_as_tuple. Should outlive the returned object.
+ * @return Typed arguments.
+ */
+template<typename... Args>
+[[nodiscard]] typed_arguments make_typed_arguments(const std::tuple<Args...> &values) {
+    static_assert(are_arguments_v<Args...>, "Argument type is not supported");
+
+    return {std::int32_t(sizeof...(Args)), &append_arguments<std::tuple<Args...>, Args...>, &values};
+}
+
+} // namespace ignite::detail
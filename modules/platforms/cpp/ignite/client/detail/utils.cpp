@@ -17,85 +17,89 @@
 
 #include "utils.h"
 
+#include "ignite/client/detail/tuple_writer.h"
+
 #include <ignite/common/bits.h>
 #include <ignite/common/uuid.h>
 
+#include <memory>
 #include <string>
 
 namespace ignite::detail {
 
 /**
- * Claim space for the column.
+ * Append column value of the type known at compile time to binary tuple.
  *
+ * @tparam TYPE Column type.
  * @param builder Binary tuple builder.
- * @param typ Column type.
  * @param value Value.
  * @param scale Column scale.
  */
-void claim_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value, std::int32_t scale) {
-    switch (typ) {
-        case ignite_type::INT8:
-            builder.claim_int8(value.get<std::int8_t>());
-            break;
-        case ignite_type::INT16:
-            builder.claim_int16(value.get<std::int16_t>());
-            break;
-        case ignite_type::INT32:
-            builder.claim_int32(value.get<std::int32_t>());
-            break;
-        case ignite_type::INT64:
-            builder.claim_int64(value.get<std::int64_t>());
-            break;
-        case ignite_type::FLOAT:
-            builder.claim_float(value.get<float>());
-            break;
-        case ignite_type::DOUBLE:
-            builder.claim_double(value.get<double>());
-            break;
-        case ignite_type::UUID:
-            builder.claim_uuid(value.get<uuid>());
-            break;
-        case ignite_type::STRING:
-            builder.claim_string(value.get<std::string>());
-            break;
-        case ignite_type::BYTE_ARRAY:
-            builder.claim_bytes(value.get<std::vector<std::byte>>());
-            break;
-        case ignite_type::DECIMAL: {
-            big_decimal to_write;
-            value.get<big_decimal>().set_scale(scale, to_write);
-            builder.claim_number(to_write);
-            break;
-        }
-        case ignite_type::NUMBER:
-            builder.claim_number(value.get<big_integer>());
-            break;
-        case ignite_type::DATE:
-            builder.claim_date(value.get<ignite_date>());
-            break;
-        case ignite_type::TIME:
-            builder.claim_time(value.get<ignite_time>());
-            break;
-        case ignite_type::DATETIME:
-            builder.claim_date_time(value.get<ignite_date_time>());
-            break;
-        case ignite_type::TIMESTAMP:
-            builder.claim_timestamp(value.get<ignite_timestamp>());
-            break;
-        case ignite_type::PERIOD:
-            builder.claim_period(value.get<ignite_period>());
-            break;
-        case ignite_type::DURATION:
-            builder.claim_duration(value.get<ignite_duration>());
-            break;
-        case ignite_type::BITMASK:
-            builder.claim_bytes(value.get<bit_array>().get_raw());
-            break;
-        default:
-            throw ignite_error("Type with id " + std::to_string(int(typ)) + " is not yet supported");
+template<ignite_type TYPE>
+void append_typed_column(binary_tuple_builder &builder, const primitive &value, std::int32_t scale) {
+    if constexpr (TYPE == ignite_type::INT8) {
+        builder.append_int8(value.get<std::int8_t>());
+    } else if constexpr (TYPE == ignite_type::INT16) {
+        builder.append_int16(value.get<std::int16_t>());
+    } else if constexpr (TYPE == ignite_type::INT32) {
+        builder.append_int32(value.get<std::int32_t>());
+    } else if constexpr (TYPE == ignite_type::INT64) {
+        builder.append_int64(value.get<std::int64_t>());
+    } else if constexpr (TYPE == ignite_type::FLOAT) {
+        builder.append_float(value.get<float>());
+    } else if constexpr (TYPE == ignite_type::DOUBLE) {
+        builder.append_double(value.get<double>());
+    } else if constexpr (TYPE == ignite_type::UUID) {
+        builder.append_uuid(value.get<uuid>());
+    } else if constexpr (TYPE == ignite_type::STRING) {
+        builder.append_string(value.get<std::string>());
+    } else if constexpr (TYPE == ignite_type::BYTE_ARRAY) {
+        builder.append_bytes(value.get<std::vector<std::byte>>());
+    } else if constexpr (TYPE == ignite_type::DECIMAL) {
+        big_decimal to_write;
+        value.get<big_decimal>().set_scale(scale, to_write);
+        builder.append_number(to_write);
+    } else if constexpr (TYPE == ignite_type::NUMBER) {
+        builder.append_number(value.get<big_integer>());
+    } else if constexpr (TYPE == ignite_type::DATE) {
+        builder.append_date(value.get<ignite_date>());
+    } else if constexpr (TYPE == ignite_type::TIME) {
+        builder.append_time(value.get<ignite_time>());
+    } else if constexpr (TYPE == ignite_type::DATETIME) {
+        builder.append_date_time(value.get<ignite_date_time>());
+    } else if constexpr (TYPE == ignite_type::TIMESTAMP) {
+        builder.append_timestamp(value.get<ignite_timestamp>());
+    } else if constexpr (TYPE == ignite_type::PERIOD) {
+        builder.append_period(value.get<ignite_period>());
+    } else if constexpr (TYPE == ignite_type::DURATION) {
+        builder.append_duration(value.get<ignite_duration>());
+    } else {
+        static_assert(TYPE == ignite_type::BITMASK, "Unsupported column type");
+        builder.append_bytes(value.get<bit_array>().get_raw());
     }
 }
 
+/** Cases of all the column types supported by the typed encoders. */
+#define IGNITE_TYPED_COLUMN_CASES(CASE)                                                                                \
+    CASE(ignite_type::INT8)                                                                                            \
+    CASE(ignite_type::INT16)                                                                                           \
+    CASE(ignite_type::INT32)                                                                                           \
+    CASE(ignite_type::INT64)                                                                                           \
+    CASE(ignite_type::FLOAT)                                                                                           \
+    CASE(ignite_type::DOUBLE)                                                                                          \
+    CASE(ignite_type::UUID)                                                                                            \
+    CASE(ignite_type::STRING)                                                                                          \
+    CASE(ignite_type::BYTE_ARRAY)                                                                                      \
+    CASE(ignite_type::DECIMAL)                                                                                         \
+    CASE(ignite_type::NUMBER)                                                                                          \
+    CASE(ignite_type::DATE)                                                                                            \
+    CASE(ignite_type::TIME)                                                                                            \
+    CASE(ignite_type::DATETIME)                                                                                        \
+    CASE(ignite_type::TIMESTAMP)                                                                                       \
+    CASE(ignite_type::PERIOD)                                                                                          \
+    CASE(ignite_type::DURATION)                                                                                        \
+    CASE(ignite_type::BITMASK)
+
 /**
  * Append column value to binary tuple.
  *
@@ -105,121 +109,271 @@ void claim_column(binary_tuple_builder &builder, ignite_type typ, const primitiv
  * @param scale Column scale.
  */
 void append_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value, std::int32_t scale) {
+#define IGNITE_APPEND_TYPED_COLUMN(TYPE)                                                                               \
+    case TYPE:                                                                                                         \
+        append_typed_column<TYPE>(builder, value, scale);                                                              \
+        break;
+
     switch (typ) {
-        case ignite_type::INT8:
-            builder.append_int8(value.get<std::int8_t>());
-            break;
-        case ignite_type::INT16:
-            builder.append_int16(value.get<std::int16_t>());
-            break;
-        case ignite_type::INT32:
-            builder.append_int32(value.get<std::int32_t>());
-            break;
-        case ignite_type::INT64:
-            builder.append_int64(value.get<std::int64_t>());
-            break;
-        case ignite_type::FLOAT:
-            builder.append_float(value.get<float>());
-            break;
-        case ignite_type::DOUBLE:
-            builder.append_double(value.get<double>());
-            break;
-        case ignite_type::UUID:
-            builder.append_uuid(value.get<uuid>());
-            break;
-        case ignite_type::STRING:
-            builder.append_string(value.get<std::string>());
-            break;
-        case ignite_type::BYTE_ARRAY:
-            builder.append_bytes(value.get<std::vector<std::byte>>());
-            break;
-        case ignite_type::DECIMAL: {
-            big_decimal to_write;
-            value.get<big_decimal>().set_scale(scale, to_write);
-            builder.append_number(to_write);
-            break;
-        }
-        case ignite_type::NUMBER:
-            builder.append_number(value.get<big_integer>());
-            break;
-        case ignite_type::DATE:
-            builder.append_date(value.get<ignite_date>());
-            break;
-        case ignite_type::TIME:
-            builder.append_time(value.get<ignite_time>());
-            break;
-        case ignite_type::DATETIME:
-            builder.append_date_time(value.get<ignite_date_time>());
-            break;
-        case ignite_type::TIMESTAMP:
-            builder.append_timestamp(value.get<ignite_timestamp>());
-            break;
-        case ignite_type::PERIOD:
-            builder.append_period(value.get<ignite_period>());
-            break;
-        case ignite_type::DURATION:
-            builder.append_duration(value.get<ignite_duration>());
-            break;
-        case ignite_type::BITMASK:
-            builder.append_bytes(value.get<bit_array>().get_raw());
-            break;
+        IGNITE_TYPED_COLUMN_CASES(IGNITE_APPEND_TYPED_COLUMN)
         default:
             throw ignite_error("Type with id " + std::to_string(int(typ)) + " is not yet supported");
     }
+
+#undef IGNITE_APPEND_TYPED_COLUMN
 }
 
 /**
- * Serialize tuple using table schema.
+ * Get encoder for the column type.
+ *
+ * @param typ Column type.
+ * @return Encoder.
+ */
+binding_plan::encoder get_encoder(ignite_type typ) {
+#define IGNITE_TYPED_ENCODER(TYPE)                                                                                     \
+    case TYPE:                                                                                                         \
+        return &append_typed_column<TYPE>;
+
+    switch (typ) {
+        IGNITE_TYPED_COLUMN_CASES(IGNITE_TYPED_ENCODER)
+        default:
+            // Unsupported types are only reported when there is an actual value to write.
+            return nullptr;
+    }
+
+#undef IGNITE_TYPED_ENCODER
+}
+
+#undef IGNITE_TYPED_COLUMN_CASES
+
+/**
+ * Check whether the binding plan was built for a tuple of the same shape.
+ *
+ * @param plan Binding plan.
+ * @param tuple Tuple.
+ * @param layout Layout of the tuple source with encoders, or @c nullptr.
+ * @param shape_hash Shape hash of the tuple.
+ * @param key_only Should only key fields be serialized.
+ * @return @c true if the plan can be used for the tuple.
+ */
+bool plan_matches(
+    const binding_plan &plan, const ignite_tuple &tuple, const void *layout, std::size_t shape_hash, bool key_only) {
+    if (plan.key_only != key_only || plan.layout != layout)
+        return false;
+
+    if (layout)
+        return true;
+
+    if (plan.column_count != tuple.column_count() || plan.shape_hash != shape_hash)
+        return false;
+
+    // Shape hashes may collide, so the names are compared as well. Names are normalized only when they differ.
+    for (std::int32_t i = 0; i < plan.column_count; ++i) {
+        const auto &name = tuple.column_name(std::uint32_t(i));
+        const auto &plan_name = plan.column_names[i];
+        if (name != plan_name && tuple_source::parse_name(name) != tuple_source::parse_name(plan_name))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Build a binding plan of the tuple to the schema columns.
  *
  * @param sch Schema.
  * @param tuple Tuple.
+ * @param source Source of the tuple with encoders, or @c nullptr.
+ * @param shape_hash Shape hash of the tuple.
  * @param key_only Should only key fields be serialized.
- * @param no_value No value bitset.
- * @return Serialized binary tuple.
+ * @return Binding plan.
  */
-std::vector<std::byte> pack_tuple(
-    const schema &sch, const ignite_tuple &tuple, bool key_only, protocol::bitset_span &no_value) {
+std::unique_ptr<binding_plan> make_binding_plan(const schema &sch, const ignite_tuple &tuple,
+    const tuple_source *source, std::size_t shape_hash, bool key_only) {
     auto count = std::int32_t(key_only ? sch.key_column_count : sch.columns.size());
-    binary_tuple_builder builder{count};
 
-    builder.start();
+    auto plan = std::make_unique<binding_plan>();
+    plan->key_only = key_only;
+    plan->column_count = tuple.column_count();
+    plan->shape_hash = shape_hash;
+
+    const tuple_source::encoder *source_encoders = nullptr;
+    if (source) {
+        source_encoders = source->encoders();
+        plan->layout = source_encoders;
+    } else {
+        plan->column_names.reserve(plan->column_count);
+        for (std::int32_t i = 0; i < plan->column_count; ++i)
+            plan->column_names.push_back(tuple.column_name(std::uint32_t(i)));
+    }
 
+    plan->columns.reserve(count);
     for (std::int32_t i = 0; i < count; ++i) {
         const auto &col = sch.columns[i];
-        auto col_idx = tuple.column_ordinal(col.name);
 
-        if (col_idx >= 0)
-            claim_column(builder, col.type, tuple.get(col_idx), col.scale);
-        else
-            builder.claim(std::nullopt);
+        binding_plan::column_binding binding;
+        binding.tuple_idx = tuple.column_ordinal(col.name);
+        binding.scale = col.scale;
+        binding.append = get_encoder(col.type);
+
+        if (source_encoders && binding.tuple_idx >= 0) {
+            if (source->column_type(binding.tuple_idx) != col.type)
+                throw ignite_error("Column type mismatch: column=" + col.name);
+
+            binding.source_append = source_encoders[binding.tuple_idx];
+        }
+
+        plan->columns.push_back(binding);
     }
 
-    builder.layout();
-    for (std::int32_t i = 0; i < count; ++i) {
-        const auto &col = sch.columns[i];
-        auto col_idx = tuple.column_ordinal(col.name);
+    return plan;
+}
 
-        if (col_idx >= 0)
-            append_column(builder, col.type, tuple.get(col_idx), col.scale);
-        else {
+/**
+ * Get a cached binding plan for the tuple shape or build and cache a new one.
+ *
+ * Plans are looked up by the layout of the tuple source or by the shape hash of the tuple, without locking.
+ *
+ * @param sch Schema.
+ * @param tuple Tuple.
+ * @param key_only Should only key fields be serialized.
+ * @param uncached Holder of the plan if it could not be cached.
+ * @return Binding plan.
+ */
+const binding_plan *get_binding_plan(
+    const schema &sch, const ignite_tuple &tuple, bool key_only, std::unique_ptr<binding_plan> &uncached) {
+    auto source = tuple_source::get_source(tuple).first;
+    if (source && !source->encoders())
+        source = nullptr;
+
+    const void *layout = source ? source->encoders() : nullptr;
+    auto shape_hash = layout ? 0 : tuple_source::get_shape_hash(tuple);
+
+    std::size_t free_slot = 0;
+    for (; free_slot < schema::MAX_BINDING_PLANS; ++free_slot) {
+        auto plan = sch.plans[free_slot].load(std::memory_order_acquire);
+        if (!plan)
+            break;
+
+        if (plan_matches(*plan, tuple, layout, shape_hash, key_only))
+            return plan;
+    }
+
+    auto plan = make_binding_plan(sch, tuple, source, shape_hash, key_only);
+    for (; free_slot < schema::MAX_BINDING_PLANS; ++free_slot) {
+        const binding_plan *expected = nullptr;
+        if (sch.plans[free_slot].compare_exchange_strong(expected, plan.get(), std::memory_order_acq_rel))
+            return plan.release();
+
+        // Another thread may have cached the plan for the same shape concurrently.
+        if (plan_matches(*expected, tuple, layout, shape_hash, key_only))
+            return expected;
+    }
+
+    uncached = std::move(plan);
+    return uncached.get();
+}
+
+/**
+ * Append values of the range of the schema columns taken from the tuple.
+ *
+ * @param builder Binary tuple builder.
+ * @param sch Schema.
+ * @param tuple Tuple.
+ * @param plan Binding plan of the tuple.
+ * @param begin First column of the range.
+ * @param end Column past the last column of the range.
+ * @param no_value No value bitset.
+ */
+void append_columns(binary_tuple_builder &builder, const schema &sch, const ignite_tuple &tuple,
+    const binding_plan &plan, std::size_t begin, std::size_t end, protocol::bitset_span &no_value) {
+    auto [source, row] = tuple_source::get_source(tuple);
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const auto &binding = plan.columns[i];
+        if (binding.tuple_idx < 0) {
             builder.append(std::nullopt);
-            no_value.set(std::size_t(i));
+            no_value.set(i);
+            continue;
+        }
+
+        if (binding.source_append) {
+            tuple_writer writer(builder);
+            binding.source_append(writer, *source, row, binding.scale);
+            continue;
         }
+
+        const auto &value = tuple.get(std::uint32_t(binding.tuple_idx));
+        if (binding.append)
+            binding.append(builder, value, binding.scale);
+        else
+            append_column(builder, sch.columns[i].type, value, binding.scale);
     }
+}
 
-    return builder.build();
+/**
+ * Write tuple using table schema and writer.
+ *
+ * The tuple is built in a single pass and then written in place in the writer buffer.
+ *
+ * @param writer Writer.
+ * @param builder Binary tuple builder for the number of columns to write.
+ * @param sch Schema.
+ * @param tuple Tuple.
+ * @param key_only Should only key fields be written or not.
+ */
+void write_tuple(protocol::writer &writer, binary_tuple_builder &builder, const schema &sch,
+    const ignite_tuple &tuple, bool key_only) {
+    std::unique_ptr<binding_plan> uncached;
+    auto plan = get_binding_plan(sch, tuple, key_only, uncached);
+    auto count = plan->columns.size();
+
+    const std::size_t bytes_num = bytes_for_bits(count);
+
+    auto no_value_bytes = reinterpret_cast<std::byte *>(alloca(bytes_num));
+    protocol::bitset_span no_value(no_value_bytes, bytes_num);
+
+    builder.start_single_pass();
+    append_columns(builder, sch, tuple, *plan, 0, count, no_value);
+
+    writer.write_bitset(no_value.data());
+    builder.build(writer.reserve_binary(builder.get_tuple_size()));
 }
 
 /**
- * Claim type and scale header for a value written in binary tuple.
+ * Write record given as separate key and value tuples using table schema and writer.
  *
- * @param builder Tuple builder.
- * @param typ Type.
- * @param scale Scale.
+ * Key columns are taken from the key tuple, and all the other columns are taken from the value tuple. The record is
+ * built in a single pass and then written in place in the writer buffer.
+ *
+ * @param writer Writer.
+ * @param builder Binary tuple builder for the number of all schema columns.
+ * @param sch Schema.
+ * @param key Key tuple.
+ * @param value Value tuple.
  */
-void claim_type_and_scale(binary_tuple_builder &builder, ignite_type typ, std::int32_t scale = 0) {
-    builder.claim_int32(static_cast<std::int32_t>(typ));
-    builder.claim_int32(scale);
+void write_tuple(protocol::writer &writer, binary_tuple_builder &builder, const schema &sch, const ignite_tuple &key,
+    const ignite_tuple &value) {
+    std::unique_ptr<binding_plan> key_uncached;
+    auto key_plan = get_binding_plan(sch, key, true, key_uncached);
+
+    std::unique_ptr<binding_plan> value_uncached;
+    auto value_plan = get_binding_plan(sch, value, false, value_uncached);
+
+    auto key_count = std::size_t(sch.key_column_count);
+    auto count = sch.columns.size();
+
+    const std::size_t bytes_num = bytes_for_bits(count);
+
+    auto no_value_bytes = reinterpret_cast<std::byte *>(alloca(bytes_num));
+    protocol::bitset_span no_value(no_value_bytes, bytes_num);
+
+    builder.start_single_pass();
+    append_columns(builder, sch, key, *key_plan, 0, key_count, no_value);
+    append_columns(builder, sch, value, *value_plan, key_count, count, no_value);
+
+    writer.write_bitset(no_value.data());
+    builder.build(writer.reserve_binary(builder.get_tuple_size()));
 }
 
 /**
@@ -234,117 +388,6 @@ void append_type_and_scale(binary_tuple_builder &builder, ignite_type typ, std::
     builder.append_int32(scale);
 }
 
-void claim_primitive_with_type(binary_tuple_builder &builder, const primitive &value) {
-    if (value.is_null()) {
-        builder.claim(std::nullopt); // Type.
-        builder.claim(std::nullopt); // Scale.
-        builder.claim(std::nullopt); // Value.
-        return;
-    }
-
-    switch (value.get_type()) {
-        case ignite_type::BOOLEAN: {
-            claim_type_and_scale(builder, ignite_type::INT8);
-            builder.claim_int8(1);
-            break;
-        }
-        case ignite_type::INT8: {
-            claim_type_and_scale(builder, ignite_type::INT8);
-            builder.claim_int8(value.get<std::int8_t>());
-            break;
-        }
-        case ignite_type::INT16: {
-            claim_type_and_scale(builder, ignite_type::INT16);
-            builder.claim_int16(value.get<std::int16_t>());
-            break;
-        }
-        case ignite_type::INT32: {
-            claim_type_and_scale(builder, ignite_type::INT32);
-            builder.claim_int32(value.get<std::int32_t>());
-            break;
-        }
-        case ignite_type::INT64: {
-            claim_type_and_scale(builder, ignite_type::INT64);
-            builder.claim_int64(value.get<std::int64_t>());
-            break;
-        }
-        case ignite_type::FLOAT: {
-            claim_type_and_scale(builder, ignite_type::FLOAT);
-            builder.claim_float(value.get<float>());
-            break;
-        }
-        case ignite_type::DOUBLE: {
-            claim_type_and_scale(builder, ignite_type::DOUBLE);
-            builder.claim_double(value.get<double>());
-            break;
-        }
-        case ignite_type::UUID: {
-            claim_type_and_scale(builder, ignite_type::UUID);
-            builder.claim_uuid(value.get<uuid>());
-            break;
-        }
-        case ignite_type::STRING: {
-            claim_type_and_scale(builder, ignite_type::STRING);
-            builder.claim_string(value.get<std::string>());
-            break;
-        }
-        case ignite_type::BYTE_ARRAY: {
-            claim_type_and_scale(builder, ignite_type::BYTE_ARRAY);
-            auto &data = value.get<std::vector<std::byte>>();
-            builder.claim_bytes(data);
-            break;
-        }
-        case ignite_type::DECIMAL: {
-            const auto &dec_value = value.get<big_decimal>();
-            claim_type_and_scale(builder, ignite_type::DECIMAL, dec_value.get_scale());
-            builder.claim_number(dec_value);
-            break;
-        }
-        case ignite_type::NUMBER: {
-            claim_type_and_scale(builder, ignite_type::NUMBER);
-            builder.claim_number(value.get<big_integer>());
-            break;
-        }
-        case ignite_type::DATE: {
-            claim_type_and_scale(builder, ignite_type::DATE);
-            builder.claim_date(value.get<ignite_date>());
-            break;
-        }
-        case ignite_type::TIME: {
-            claim_type_and_scale(builder, ignite_type::TIME);
-            builder.claim_time(value.get<ignite_time>());
-            break;
-        }
-        case ignite_type::DATETIME: {
-            claim_type_and_scale(builder, ignite_type::DATETIME);
-            builder.claim_date_time(value.get<ignite_date_time>());
-            break;
-        }
-        case ignite_type::TIMESTAMP: {
-            claim_type_and_scale(builder, ignite_type::TIMESTAMP);
-            builder.claim_timestamp(value.get<ignite_timestamp>());
-            break;
-        }
-        case ignite_type::PERIOD: {
-            claim_type_and_scale(builder, ignite_type::PERIOD);
-            builder.claim_period(value.get<ignite_period>());
-            break;
-        }
-        case ignite_type::DURATION: {
-            claim_type_and_scale(builder, ignite_type::DURATION);
-            builder.claim_duration(value.get<ignite_duration>());
-            break;
-        }
-        case ignite_type::BITMASK: {
-            claim_type_and_scale(builder, ignite_type::BITMASK);
-            builder.claim_bytes(value.get<bit_array>().get_raw());
-            break;
-        }
-        default:
-            throw ignite_error("Unsupported type: " + std::to_string(int(value.get_type())));
-    }
-}
-
 void append_primitive_with_type(binary_tuple_builder &builder, const primitive &value) {
     if (value.is_null()) {
         builder.append(std::nullopt); // Type.
@@ -457,7 +500,10 @@ void append_primitive_with_type(binary_tuple_builder &builder, const primitive &
 }
 
 primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::int32_t scale) {
-    auto val_opt = parser.get_next();
+    return read_column(parser.get_next(), typ, scale);
+}
+
+primitive read_column(std::optional<bytes_view> val_opt, ignite_type typ, std::int32_t scale) {
     if (!val_opt)
         return {};
 
@@ -507,38 +553,43 @@ primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::in
     }
 }
 
-ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right) {
-    // TODO: IGNITE-18855 eliminate unnecessary tuple transformation;
+void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only) {
+    binary_tuple_builder builder{std::int32_t(key_only ? sch.key_column_count : sch.columns.size())};
 
-    ignite_tuple res(left.column_count() + right.column_count());
-    res.m_pairs.assign(left.m_pairs.begin(), left.m_pairs.end());
-    res.m_indices.insert(left.m_indices.begin(), left.m_indices.end());
+    write_tuple(writer, builder, sch, tuple, key_only);
+}
 
-    for (const auto &pair : right.m_pairs) {
-        res.m_pairs.emplace_back(pair);
-        res.m_indices.emplace(ignite_tuple::parse_name(pair.first), res.m_pairs.size() - 1);
-    }
+void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only) {
+    binary_tuple_builder builder{std::int32_t(key_only ? sch.key_column_count : sch.columns.size())};
 
-    return res;
+    writer.write(std::int32_t(tuples.size()));
+    for (auto &tuple : tuples)
+        write_tuple(writer, builder, sch, tuple, key_only);
 }
 
-void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only) {
-    const std::size_t count = key_only ? sch.key_column_count : sch.columns.size();
-    const std::size_t bytes_num = bytes_for_bits(count);
+void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &key, const ignite_tuple &value) {
+    binary_tuple_builder builder{std::int32_t(sch.columns.size())};
 
-    auto no_value_bytes = reinterpret_cast<std::byte *>(alloca(bytes_num));
-    protocol::bitset_span no_value(no_value_bytes, bytes_num);
+    write_tuple(writer, builder, sch, key, value);
+}
 
-    auto tuple_data = pack_tuple(sch, tuple, key_only, no_value);
+void write_tuples(
+    protocol::writer &writer, const schema &sch, const std::vector<std::pair<ignite_tuple, ignite_tuple>> &pairs) {
+    binary_tuple_builder builder{std::int32_t(sch.columns.size())};
 
-    writer.write_bitset(no_value.data());
-    writer.write_binary(tuple_data);
+    writer.write(std::int32_t(pairs.size()));
+    for (auto &pair : pairs)
+        write_tuple(writer, builder, sch, pair.first, pair.second);
 }
 
-void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only) {
-    writer.write(std::int32_t(tuples.size()));
-    for (auto &tuple : tuples)
-        write_tuple(writer, sch, tuple, key_only);
+void write_typed_arguments(protocol::writer &writer, const typed_arguments &args) {
+    binary_tuple_builder builder{args.count * 3};
+
+    builder.start_single_pass();
+    tuple_writer tuple(builder);
+    args.append(tuple, args.values);
+
+    builder.build(writer.reserve_binary(builder.get_tuple_size()));
 }
 
 } // namespace ignite::detail
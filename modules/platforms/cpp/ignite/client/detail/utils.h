@@ -18,6 +18,7 @@
 #pragma once
 
 #include "ignite/client/detail/table/schema.h"
+#include "ignite/client/detail/typed_arguments.h"
 #include "ignite/client/primitive.h"
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/client/transaction/transaction.h"
@@ -28,14 +29,6 @@
 
 namespace ignite::detail {
 
-/**
- * Claim space for a value with type header in tuple builder.
- *
- * @param builder Tuple builder.
- * @param value Value.
- */
-void claim_primitive_with_type(binary_tuple_builder &builder, const primitive &value);
-
 /**
  * Append a value with type header in tuple builder.
  *
@@ -55,13 +48,14 @@ void append_primitive_with_type(binary_tuple_builder &builder, const primitive &
 [[nodiscard]] primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::int32_t scale);
 
 /**
- * Tuple concatenation function.
+ * Read column value from binary tuple element.
  *
- * @param left Left hand value.
- * @param right Right hand value.
- * @return Resulting tuple.
+ * @param val_opt Binary tuple element.
+ * @param typ Column type.
+ * @param scale Column scale.
+ * @return Column value.
  */
-[[nodiscard]] ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right);
+[[nodiscard]] primitive read_column(std::optional<bytes_view> val_opt, ignite_type typ, std::int32_t scale);
 
 /**
  * Write tuple using table schema and writer.
@@ -83,4 +77,34 @@ void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple
  */
 void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only);
 
+/**
+ * Write record given as separate key and value tuples using table schema and writer.
+ *
+ * @param writer Writer.
+ * @param sch Schema.
+ * @param key Key tuple.
+ * @param value Value tuple.
+ */
+void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &key, const ignite_tuple &value);
+
+/**
+ * Write records given as pairs of key and value tuples using table schema and writer.
+ *
+ * @param writer Writer.
+ * @param sch Schema.
+ * @param pairs Pairs of key and value tuples.
+ */
+void write_tuples(
+    protocol::writer &writer, const schema &sch, const std::vector<std::pair<ignite_tuple, ignite_tuple>> &pairs);
+
+/**
+ * Write typed arguments as a binary tuple of type, scale and value triples.
+ *
+ * The tuple is built in a single pass straight in the writer buffer.
+ *
+ * @param writer Writer.
+ * @param args Typed arguments.
+ */
+void write_typed_arguments(protocol::writer &writer, const typed_arguments &args);
+
 } // namespace ignite::detail
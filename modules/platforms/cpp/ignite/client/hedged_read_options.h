@@ -0,0 +1,116 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+
+namespace ignite {
+
+/**
+ * Hedged read options.
+ *
+ * With hedged reads, a key-value read made outside of a transaction which has not been answered within the hedging
+ * delay is sent once more to another cluster node. The first response is used and the other one is discarded, so a
+ * single slow node does not determine the tail latency of the reads. Reads are only hedged when the client is
+ * connected to more than one node.
+ */
+class hedged_read_options {
+public:
+    /** Default latency percentile used to derive the hedging delay. */
+    static constexpr double DEFAULT_PERCENTILE{0.95};
+
+    /** Default maximum share of hedged requests. */
+    static constexpr double DEFAULT_MAX_EXTRA_LOAD{0.05};
+
+    // Default
+    hedged_read_options() = default;
+
+    /**
+     * Gets a value indicating whether reads are hedged.
+     *
+     * @return @c true if reads are hedged.
+     */
+    [[nodiscard]] bool enabled() const { return m_enabled; }
+
+    /**
+     * Sets a value indicating whether reads are hedged. Disabled by default.
+     *
+     * @param val @c true to hedge reads.
+     */
+    void enabled(bool val) { m_enabled = val; }
+
+    /**
+     * Gets the fixed hedging delay.
+     *
+     * @return Fixed hedging delay.
+     */
+    [[nodiscard]] std::chrono::milliseconds delay() const { return m_delay; }
+
+    /**
+     * Sets the fixed hedging delay. Zero value means that the delay is derived from the observed latency of the
+     * operation, see @c percentile. The default value is zero.
+     *
+     * @param val Fixed hedging delay.
+     */
+    void delay(std::chrono::milliseconds val) { m_delay = val; }
+
+    /**
+     * Gets the latency percentile used to derive the hedging delay.
+     *
+     * @return Latency percentile.
+     */
+    [[nodiscard]] double percentile() const { return m_percentile; }
+
+    /**
+     * Sets the latency percentile used to derive the hedging delay when no fixed delay is set. Must be in the
+     * (0, 1) range. Reads are not hedged until enough latency samples of the operation are collected.
+     *
+     * @param val Latency percentile.
+     */
+    void percentile(double val) { m_percentile = val; }
+
+    /**
+     * Gets the maximum share of hedged requests.
+     *
+     * @return Maximum share of hedged requests.
+     */
+    [[nodiscard]] double max_extra_load() const { return m_max_extra_load; }
+
+    /**
+     * Sets the maximum share of hedged requests. For example, 0.05 means that at most one read in twenty is
+     * hedged over time, which caps the extra load on the cluster at 5%.
+     *
+     * @param val Maximum share of hedged requests.
+     */
+    void max_extra_load(double val) { m_max_extra_load = val; }
+
+private:
+    /** Enabled flag. */
+    bool m_enabled{false};
+
+    /** Fixed hedging delay. */
+    std::chrono::milliseconds m_delay{0};
+
+    /** Latency percentile. */
+    double m_percentile{DEFAULT_PERCENTILE};
+
+    /** Maximum share of hedged requests. */
+    double m_max_extra_load{DEFAULT_MAX_EXTRA_LOAD};
+};
+
+} // namespace ignite
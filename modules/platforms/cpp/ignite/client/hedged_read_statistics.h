@@ -0,0 +1,41 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Hedged read statistics.
+ */
+struct hedged_read_statistics {
+    /** Number of reads which could be hedged. */
+    std::int64_t reads{0};
+
+    /** Number of hedged requests sent. */
+    std::int64_t hedges_issued{0};
+
+    /** Number of reads answered by the hedged request first. */
+    std::int64_t hedges_won{0};
+
+    /** Number of hedged requests not sent because the extra load limit was reached. */
+    std::int64_t hedges_over_budget{0};
+};
+
+} // namespace ignite
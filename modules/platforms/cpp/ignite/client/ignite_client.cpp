@@ -93,6 +93,14 @@ std::vector<cluster_node> ignite_client::get_cluster_nodes() {
         [this](auto callback) mutable { get_cluster_nodes_async(std::move(callback)); });
 }
 
+hedged_read_statistics ignite_client::get_hedged_read_statistics() const {
+    return impl().get_hedged_read_statistics();
+}
+
+std::vector<concurrency_limit_statistics> ignite_client::get_concurrency_limit_statistics() const {
+    return impl().get_concurrency_limit_statistics();
+}
+
 detail::ignite_client_impl &ignite_client::impl() noexcept {
     return *((detail::ignite_client_impl *) (m_impl.get()));
 }
@@ -18,6 +18,8 @@
 #pragma once
 
 #include "ignite/client/compute/compute.h"
+#include "ignite/client/concurrency_limit_statistics.h"
+#include "ignite/client/hedged_read_statistics.h"
 #include "ignite/client/ignite_client_configuration.h"
 #include "ignite/client/network/cluster_node.h"
 #include "ignite/client/sql/sql.h"
@@ -139,6 +141,24 @@ public:
      */
     [[nodiscard]] IGNITE_API std::vector<cluster_node> get_cluster_nodes();
 
+    /**
+     * Gets the hedged read statistics.
+     *
+     * @see ignite_client_configuration::set_hedged_reads for details.
+     *
+     * @return Hedged read statistics. All zeroes if hedged reads are disabled.
+     */
+    [[nodiscard]] IGNITE_API hedged_read_statistics get_hedged_read_statistics() const;
+
+    /**
+     * Gets the concurrency limit statistics of every active connection, including the current limit.
+     *
+     * @see ignite_client_configuration::set_concurrency_limit for details.
+     *
+     * @return Concurrency limit statistics. Empty if the concurrency limit is disabled.
+     */
+    [[nodiscard]] IGNITE_API std::vector<concurrency_limit_statistics> get_concurrency_limit_statistics() const;
+
 private:
     /**
      * Constructor
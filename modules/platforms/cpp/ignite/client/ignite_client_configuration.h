@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <ignite/client/concurrency_limit_options.h>
+#include <ignite/client/hedged_read_options.h>
 #include <ignite/client/ignite_logger.h>
 #include <ignite/client/ignite_client_authenticator.h>
 
@@ -137,6 +139,38 @@ public:
         m_authenticator = std::move(authenticator);
     }
 
+    /**
+     * Gets the hedged read options.
+     *
+     * @return Hedged read options.
+     */
+    [[nodiscard]] const hedged_read_options &get_hedged_reads() const { return m_hedged_reads; }
+
+    /**
+     * Sets the hedged read options.
+     *
+     * @see hedged_read_options for details.
+     *
+     * @param options Hedged read options.
+     */
+    void set_hedged_reads(hedged_read_options options) { m_hedged_reads = options; }
+
+    /**
+     * Gets the options of the adaptive limit of requests in flight on every connection.
+     *
+     * @return Concurrency limit options.
+     */
+    [[nodiscard]] const concurrency_limit_options &get_concurrency_limit() const { return m_concurrency_limit; }
+
+    /**
+     * Sets the options of the adaptive limit of requests in flight on every connection.
+     *
+     * @see concurrency_limit_options for details.
+     *
+     * @param options Concurrency limit options.
+     */
+    void set_concurrency_limit(concurrency_limit_options options) { m_concurrency_limit = options; }
+
 private:
     /** Endpoints. */
     std::vector<std::string> m_endpoints{"localhost"};
@@ -149,6 +183,12 @@ private:
 
     /** Active connections limit. */
     uint32_t m_connection_limit{0};
+
+    /** Hedged read options. */
+    hedged_read_options m_hedged_reads{};
+
+    /** Concurrency limit options. */
+    concurrency_limit_options m_concurrency_limit{};
 };
 
 } // namespace ignite
@@ -48,6 +48,18 @@ std::vector<ignite_tuple> result_set::current_page() {
     return m_impl->current_page();
 }
 
+void result_set::current_page_arrow(ArrowSchema *schema, ArrowArray *array) {
+    m_impl->current_page_arrow(schema, array);
+}
+
+result_set::row_range result_set::rows() {
+    return row_range(m_impl);
+}
+
+result_set_statistics result_set::statistics() const {
+    return m_impl->statistics();
+}
+
 bool result_set::has_more_pages() {
     return m_impl->has_more_pages();
 }
@@ -56,4 +68,17 @@ void result_set::fetch_next_page_async(std::function<void(ignite_result<void>)>
     m_impl->fetch_next_page_async(std::move(callback));
 }
 
+result_set::row_iterator::row_iterator(std::shared_ptr<detail::result_set_impl> impl)
+    : m_impl(std::move(impl)) {
+    ++*this;
+}
+
+result_set::row_iterator &result_set::row_iterator::operator++() {
+    m_row = m_impl->next_row();
+    if (!m_row)
+        m_impl.reset();
+
+    return *this;
+}
+
 } // namespace ignite
@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include "ignite/client/sql/arrow.h"
 #include "ignite/client/sql/result_set_metadata.h"
+#include "ignite/client/sql/result_set_statistics.h"
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_result.h"
 
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
 
 namespace ignite {
 
@@ -36,6 +40,112 @@ class result_set_impl;
  */
 class result_set {
 public:
+    /**
+     * Input iterator over the rows of a result set.
+     *
+     * Rows are taken from the received pages one at a time and decoded on access. When the current page is
+     * exhausted, the next one is fetched synchronously.
+     */
+    class row_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ignite_tuple;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ignite_tuple *;
+        using reference = const ignite_tuple &;
+
+        // Default. Constructs an end iterator.
+        row_iterator() = default;
+
+        /**
+         * Constructor. Positions the iterator at the next row of the result set.
+         *
+         * @param impl Result set implementation.
+         */
+        IGNITE_API explicit row_iterator(std::shared_ptr<detail::result_set_impl> impl);
+
+        /**
+         * Gets the current row.
+         *
+         * @return Current row.
+         */
+        reference operator*() const { return *m_row; }
+
+        /**
+         * Gets the current row.
+         *
+         * @return Current row.
+         */
+        pointer operator->() const { return &*m_row; }
+
+        /**
+         * Moves to the next row.
+         *
+         * @return This iterator.
+         */
+        IGNITE_API row_iterator &operator++();
+
+        /**
+         * Moves to the next row.
+         */
+        void operator++(int) { ++*this; }
+
+        /**
+         * Compares iterators. Iterators over the same result set are only distinguished by reaching the end.
+         *
+         * @param other Other iterator.
+         * @return @c true if both iterators either reached the end or not.
+         */
+        bool operator==(const row_iterator &other) const { return m_row.has_value() == other.m_row.has_value(); }
+
+        /**
+         * Compares iterators.
+         *
+         * @param other Other iterator.
+         * @return @c true if iterators are not equal.
+         */
+        bool operator!=(const row_iterator &other) const { return !(*this == other); }
+
+    private:
+        /** Implementation. */
+        std::shared_ptr<detail::result_set_impl> m_impl;
+
+        /** Current row. */
+        std::optional<ignite_tuple> m_row;
+    };
+
+    /**
+     * Range of the remaining rows of a result set.
+     */
+    class row_range {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param impl Result set implementation.
+         */
+        explicit row_range(std::shared_ptr<detail::result_set_impl> impl)
+            : m_impl(std::move(impl)) {}
+
+        /**
+         * Gets an iterator positioned at the next row of the result set.
+         *
+         * @return Iterator.
+         */
+        [[nodiscard]] row_iterator begin() const { return row_iterator(m_impl); }
+
+        /**
+         * Gets the end iterator.
+         *
+         * @return End iterator.
+         */
+        [[nodiscard]] row_iterator end() const { return {}; }
+
+    private:
+        /** Implementation. */
+        std::shared_ptr<detail::result_set_impl> m_impl;
+    };
+
     // Default
     result_set() = default;
 
@@ -101,6 +211,43 @@ public:
      */
     [[nodiscard]] IGNITE_API std::vector<ignite_tuple> current_page();
 
+    /**
+     * Exports current page using the Apache Arrow C Data Interface.
+     *
+     * Rows are exported as a struct array with a child array for every column, with the struct schema describing
+     * the columns. Columns are decoded directly from the received data into Arrow buffers, so the result can be
+     * passed to an Arrow consumer without further copying. Both structures must be released by the consumer.
+     *
+     * As with @c current_page(), the result set is left empty after this operation.
+     *
+     * @param schema Schema to fill.
+     * @param array Array to fill.
+     */
+    IGNITE_API void current_page_arrow(ArrowSchema *schema, ArrowArray *array);
+
+    /**
+     * Gets the remaining rows of the result set.
+     *
+     * Unlike @c current_page(), rows are not materialized as a page: they are decoded one at a time from the
+     * received data, and following pages are fetched transparently as the iteration goes on. Only one encoded page
+     * is kept in memory at a time. Rows consumed by the iteration are not returned by @c current_page().
+     *
+     * @code
+     * for (const auto &row : rs.rows())
+     *     process(row);
+     * @endcode
+     *
+     * @return Row range.
+     */
+    [[nodiscard]] IGNITE_API row_range rows();
+
+    /**
+     * Gets statistics of the pages received so far, including the page size chosen for the query.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] IGNITE_API result_set_statistics statistics() const;
+
     /**
      * Checks whether there are more pages of results.
      *
@@ -0,0 +1,48 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Statistics of the pages received by a result set.
+ */
+struct result_set_statistics {
+    /** Page size requested for the query, in rows. */
+    std::int32_t page_size{0};
+
+    /** Number of received pages. */
+    std::int64_t pages{0};
+
+    /** Number of received rows. */
+    std::int64_t rows{0};
+
+    /** Total size of the received rows in bytes. */
+    std::int64_t bytes{0};
+
+    /**
+     * Gets the average size of a received row.
+     *
+     * @return Average row size in bytes, or zero if no rows were received.
+     */
+    [[nodiscard]] double average_row_size() const { return rows ? double(bytes) / double(rows) : 0.0; }
+};
+
+} // namespace ignite
@@ -25,4 +25,21 @@ void sql::execute_async(transaction *tx, const sql_statement &statement, std::ve
     m_impl->execute_async(tx, statement, std::move(args), std::move(callback));
 }
 
+void sql::execute_typed_async(transaction *tx, const sql_statement &statement, const detail::typed_arguments &args,
+    ignite_callback<result_set> callback) {
+    m_impl->execute_async(tx, statement, args, std::move(callback));
+}
+
+void sql::enable_result_cache(const sql_result_cache_options &options) {
+    m_impl->enable_result_cache(options);
+}
+
+void sql::disable_result_cache() {
+    m_impl->disable_result_cache();
+}
+
+void sql::invalidate_result_cache() {
+    m_impl->invalidate_result_cache();
+}
+
 } // namespace ignite
@@ -17,14 +17,17 @@
 
 #pragma once
 
+#include "ignite/client/detail/typed_arguments.h"
 #include "ignite/client/primitive.h"
 #include "ignite/client/sql/result_set.h"
+#include "ignite/client/sql/sql_result_cache_options.h"
 #include "ignite/client/sql/sql_statement.h"
 #include "ignite/client/transaction/transaction.h"
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_result.h"
 
 #include <memory>
+#include <tuple>
 #include <utility>
 
 namespace ignite {
@@ -68,7 +71,82 @@ public:
         });
     }
 
+    /**
+     * Executes single SQL statement asynchronously and returns rows.
+     *
+     * Arguments are encoded straight from their C++ types, without conversion to @c primitive.
+     *
+     * @code
+     * sql.execute_async(nullptr, statement, std::forward_as_tuple(42, "abc"), callback);
+     * @endcode
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this single operation is used.
+     * @param statement statement to execute.
+     * @param args Arguments for the statement.
+     * @param callback A callback called on operation completion with SQL result set.
+     */
+    template<typename... Args, typename = std::enable_if_t<detail::are_arguments_v<Args...>>>
+    void execute_async(transaction *tx, const sql_statement &statement, const std::tuple<Args...> &args,
+        ignite_callback<result_set> callback) {
+        execute_typed_async(tx, statement, detail::make_typed_arguments(args), std::move(callback));
+    }
+
+    /**
+     * Executes single SQL statement and returns rows.
+     *
+     * Arguments are encoded straight from their C++ types, without conversion to @c primitive.
+     *
+     * @code
+     * auto result_set = sql.execute(nullptr, statement, 42, "abc"sv, ts);
+     * @endcode
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this single operation is used.
+     * @param statement statement to execute.
+     * @param args Arguments for the statement.
+     * @return SQL result set.
+     */
+    template<typename... Args, typename = std::enable_if_t<detail::are_arguments_v<Args...>>>
+    result_set execute(transaction *tx, const sql_statement &statement, const Args &...args) {
+        auto values = std::forward_as_tuple(args...);
+        auto typed = detail::make_typed_arguments(values);
+
+        return sync<result_set>([this, tx, &statement, &typed](auto callback) {
+            execute_typed_async(tx, statement, typed, std::move(callback));
+        });
+    }
+
+    /**
+     * Enables the result cache, replacing the current one if any.
+     *
+     * Results of queries executed outside of transactions are cached when all their rows fit into the first page.
+     * Statements which do not return rows, such as DML, drop all the cached results.
+     *
+     * @param options Result cache options.
+     */
+    IGNITE_API void enable_result_cache(const sql_result_cache_options &options = {});
+
+    /**
+     * Disables the result cache.
+     */
+    IGNITE_API void disable_result_cache();
+
+    /**
+     * Drops all the cached results.
+     */
+    IGNITE_API void invalidate_result_cache();
+
 private:
+    /**
+     * Executes single SQL statement with typed arguments asynchronously.
+     *
+     * @param tx Optional transaction. If nullptr implicit transaction for this single operation is used.
+     * @param statement statement to execute.
+     * @param args Typed arguments for the statement. Only used before the call returns.
+     * @param callback A callback called on operation completion with SQL result set.
+     */
+    IGNITE_API void execute_typed_async(transaction *tx, const sql_statement &statement,
+        const detail::typed_arguments &args, ignite_callback<result_set> callback);
+
     /**
      * Constructor
      *
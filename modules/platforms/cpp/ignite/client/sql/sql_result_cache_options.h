@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace ignite {
+
+/**
+ * SQL result cache options.
+ *
+ * The result cache keeps small result sets which were fully fetched with the first page, so identical queries with
+ * the same schema and arguments are served on the client. The cache does not track changes made to the data by
+ * other clients, so results can be stale for up to the time to live.
+ */
+class sql_result_cache_options {
+public:
+    /** Default maximum total size of the cached results in bytes. */
+    static constexpr std::size_t DEFAULT_MAX_SIZE_BYTES{4 * 1024 * 1024};
+
+    /** Default maximum size of a single cached result in bytes. */
+    static constexpr std::size_t DEFAULT_MAX_ENTRY_SIZE_BYTES{64 * 1024};
+
+    /** Default result time to live. */
+    static constexpr std::chrono::milliseconds DEFAULT_TTL{1000};
+
+    // Default
+    sql_result_cache_options() = default;
+
+    /**
+     * Gets the maximum total size of the cached results in bytes.
+     *
+     * @return Maximum size in bytes.
+     */
+    [[nodiscard]] std::size_t max_size_bytes() const { return m_max_size_bytes; }
+
+    /**
+     * Sets the maximum total size of the cached results in bytes.
+     *
+     * When the limit is reached, the least recently used results are evicted.
+     *
+     * @param val Maximum size in bytes.
+     */
+    void max_size_bytes(std::size_t val) { m_max_size_bytes = val; }
+
+    /**
+     * Gets the maximum size of a single cached result in bytes.
+     *
+     * @return Maximum entry size in bytes.
+     */
+    [[nodiscard]] std::size_t max_entry_size_bytes() const { return m_max_entry_size_bytes; }
+
+    /**
+     * Sets the maximum size of a single cached result in bytes. Larger results are never cached.
+     *
+     * @param val Maximum entry size in bytes.
+     */
+    void max_entry_size_bytes(std::size_t val) { m_max_entry_size_bytes = val; }
+
+    /**
+     * Gets the result time to live.
+     *
+     * @return Result time to live.
+     */
+    [[nodiscard]] std::chrono::milliseconds ttl() const { return m_ttl; }
+
+    /**
+     * Sets the result time to live.
+     *
+     * @param val Result time to live.
+     */
+    void ttl(std::chrono::milliseconds val) { m_ttl = val; }
+
+private:
+    /** Maximum size in bytes. */
+    std::size_t m_max_size_bytes{DEFAULT_MAX_SIZE_BYTES};
+
+    /** Maximum entry size in bytes. */
+    std::size_t m_max_entry_size_bytes{DEFAULT_MAX_ENTRY_SIZE_BYTES};
+
+    /** Result time to live. */
+    std::chrono::milliseconds m_ttl{DEFAULT_TTL};
+};
+
+} // namespace ignite
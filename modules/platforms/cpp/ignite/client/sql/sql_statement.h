@@ -40,6 +40,15 @@ public:
     /** Default query timeout (zero means no timeout). */
     static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{0};
 
+    /** Default number of pages to fetch ahead of the consumer (zero means no prefetch). */
+    static constexpr std::int32_t DEFAULT_PREFETCH_DEPTH{0};
+
+    /** Default maximum total size of prefetched pages in bytes. */
+    static constexpr std::size_t DEFAULT_PREFETCH_MAX_BYTES{16 * 1024 * 1024};
+
+    /** Default target size of a data page in bytes (zero means that pages have a fixed number of rows). */
+    static constexpr std::size_t DEFAULT_TARGET_PAGE_BYTES{0};
+
     // Default
     sql_statement() = default;
 
@@ -118,6 +127,59 @@ public:
      */
     void page_size(std::int32_t val) { m_page_size = val; }
 
+    /**
+     * Gets the target size of a data page in bytes (zero means that pages have a fixed number of rows).
+     *
+     * @return Target size of a data page in bytes.
+     */
+    [[nodiscard]] std::size_t target_page_bytes() const { return m_target_page_bytes; }
+
+    /**
+     * Sets the target size of a data page in bytes (zero means that pages have a fixed number of rows).
+     *
+     * When set, the client estimates the average row size of the query from the pages it receives, and uses it to
+     * choose the number of rows per page on the following executions of the same query. The page size set with
+     * @ref page_size is used until there is an estimate. The chosen page size is reported by
+     * @c result_set::statistics.
+     *
+     * @param val Target size of a data page in bytes.
+     */
+    void target_page_bytes(std::size_t val) { m_target_page_bytes = val; }
+
+    /**
+     * Gets the number of pages to fetch ahead of the consumer (zero means no prefetch).
+     *
+     * @return Number of pages to fetch ahead of the consumer.
+     */
+    [[nodiscard]] std::int32_t prefetch_depth() const { return m_prefetch_depth; }
+
+    /**
+     * Sets the number of pages to fetch ahead of the consumer (zero means no prefetch).
+     *
+     * With a non-zero prefetch depth the request for the next page is sent in the background while the current
+     * page is being consumed, so page boundaries do not stall the consumer for a network round trip.
+     *
+     * @param val Number of pages to fetch ahead of the consumer.
+     */
+    void prefetch_depth(std::int32_t val) { m_prefetch_depth = val; }
+
+    /**
+     * Gets the maximum total size of prefetched pages in bytes.
+     *
+     * @return Maximum total size of prefetched pages in bytes.
+     */
+    [[nodiscard]] std::size_t prefetch_max_bytes() const { return m_prefetch_max_bytes; }
+
+    /**
+     * Sets the maximum total size of prefetched pages in bytes.
+     *
+     * No more pages are prefetched once the size of pages that were prefetched but not consumed yet reaches
+     * this limit, so it may be exceeded by at most one page.
+     *
+     * @param val Maximum total size of prefetched pages in bytes.
+     */
+    void prefetch_max_bytes(std::size_t val) { m_prefetch_max_bytes = val; }
+
     /**
      * Gets the statement properties.
      *
@@ -145,6 +207,15 @@ private:
     /** Page size. */
     std::int32_t m_page_size{DEFAULT_PAGE_SIZE};
 
+    /** Target page size in bytes. */
+    std::size_t m_target_page_bytes{DEFAULT_TARGET_PAGE_BYTES};
+
+    /** Prefetch depth. */
+    std::int32_t m_prefetch_depth{DEFAULT_PREFETCH_DEPTH};
+
+    /** Prefetch size limit. */
+    std::size_t m_prefetch_max_bytes{DEFAULT_PREFETCH_MAX_BYTES};
+
     /** Properties. */
     std::unordered_map<std::string, primitive> m_properties;
 };
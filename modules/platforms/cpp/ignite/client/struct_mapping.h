@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <tuple>
+
+namespace ignite {
+
+/**
+ * Mapping of the user type fields to table columns.
+ *
+ * Types are not mapped by default. Use @c IGNITE_MAP_STRUCT to declare a mapping for a type. A type with a mapping
+ * can be used with @c record_view and @c key_value_view without specializing @c convert_to_tuple and
+ * @c convert_from_tuple. Its values are serialized straight into binary tuples, and column positions are resolved
+ * once per table schema version.
+ *
+ * @tparam T User type.
+ */
+template<typename T>
+struct struct_mapping {
+    /** Whether the type is mapped. */
+    static constexpr bool mapped = false;
+};
+
+/**
+ * Mapped field.
+ *
+ * @tparam S Structure type.
+ * @tparam M Member type.
+ */
+template<typename S, typename M>
+struct mapped_field {
+    /** Type of the field. */
+    typedef M type;
+
+    /** Column name. */
+    const char *name;
+
+    /** Pointer to member. */
+    M S::*member;
+};
+
+/**
+ * Declare a mapping of the structure member to a column.
+ *
+ * @tparam S Structure type.
+ * @tparam M Member type.
+ * @param name Column name. Normalized the same way as @c ignite_tuple column names.
+ * @param member Pointer to member.
+ * @return Mapped field.
+ */
+template<typename S, typename M>
+constexpr mapped_field<S, M> field(const char *name, M S::*member) {
+    return {name, member};
+}
+
+} // namespace ignite
+
+/**
+ * Map a structure member to the column with the same name.
+ */
+#define IGNITE_FIELD(TYPE, MEMBER) ::ignite::field(#MEMBER, &TYPE::MEMBER)
+
+/**
+ * Declare a mapping of the structure to table columns. Should be used in the global namespace.
+ *
+ * Example:
+ * @code
+ * struct account {
+ *     std::int64_t id{0};
+ *     std::string name;
+ *     std::optional<std::int64_t> balance;
+ * };
+ *
+ * IGNITE_MAP_STRUCT(account, IGNITE_FIELD(account, id), IGNITE_FIELD(account, name), IGNITE_FIELD(account, balance))
+ * @endcode
+ *
+ * Supported member types are @c bool, integer and floating point types, @c std::string, @c std::vector<std::byte>
+ * and the Ignite types which can be stored in @c primitive. Nullable columns can be mapped to @c std::optional.
+ */
+#define IGNITE_MAP_STRUCT(TYPE, ...)                                                                                   \
+    namespace ignite {                                                                                                 \
+    template<>                                                                                                         \
+    struct struct_mapping<TYPE> {                                                                                      \
+        static constexpr bool mapped = true;                                                                           \
+        static constexpr auto fields() { return std::make_tuple(__VA_ARGS__); }                                        \
+    };                                                                                                                 \
+    }
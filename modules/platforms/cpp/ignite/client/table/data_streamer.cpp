@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/table/data_streamer.h"
+#include "ignite/client/detail/argument_check_utils.h"
+#include "ignite/client/detail/table/data_streamer_impl.h"
+
+namespace ignite {
+
+data_streamer::~data_streamer() {
+    if (m_impl)
+        m_impl->close_async([](auto) {});
+}
+
+void data_streamer::add(ignite_tuple record) {
+    detail::arg_check::tuple_non_empty(record, "Tuple");
+
+    m_impl->add(std::move(record));
+}
+
+void data_streamer::add(ignite_tuple key, ignite_tuple value) {
+    detail::arg_check::key_tuple_non_empty(key);
+    detail::arg_check::value_tuple_non_empty(value);
+
+    m_impl->add(std::move(key), std::move(value));
+}
+
+void data_streamer::flush_async(ignite_callback<void> callback) {
+    m_impl->flush_async(std::move(callback));
+}
+
+void data_streamer::close_async(ignite_callback<void> callback) {
+    m_impl->close_async(std::move(callback));
+}
+
+data_streamer_progress data_streamer::progress() const {
+    return m_impl->get_progress();
+}
+
+} // namespace ignite
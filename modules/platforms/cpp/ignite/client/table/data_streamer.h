@@ -0,0 +1,172 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/table/data_streamer_options.h"
+#include "ignite/client/table/data_streamer_progress.h"
+#include "ignite/client/table/ignite_tuple.h"
+#include "ignite/client/type_mapping.h"
+
+#include "ignite/common/config.h"
+#include "ignite/common/ignite_result.h"
+
+#include <memory>
+#include <utility>
+
+namespace ignite {
+
+template<typename T>
+class record_view;
+
+template<typename K, typename V>
+class key_value_view;
+
+namespace detail {
+class data_streamer_impl;
+}
+
+/**
+ * Data streamer.
+ *
+ * Streams rows into a table in batches, which is much faster than inserting them one by one. Rows can be added from
+ * any number of threads. Each row is written with upsert semantics outside of any transaction, so a row which was
+ * added is not necessarily visible until @c flush() returns.
+ *
+ * A streamer is closed on destruction, but the rows which are still buffered at that point are written in the
+ * background and errors are not reported. Call @c close() to wait for all the rows to be written.
+ */
+class data_streamer {
+    friend class record_view<ignite_tuple>;
+    friend class key_value_view<ignite_tuple, ignite_tuple>;
+
+public:
+    // Deleted
+    data_streamer(const data_streamer &) = delete;
+    data_streamer &operator=(const data_streamer &) = delete;
+
+    // Default
+    data_streamer() = default;
+    data_streamer(data_streamer &&) noexcept = default;
+    data_streamer &operator=(data_streamer &&) noexcept = default;
+
+    /**
+     * Destructor.
+     */
+    IGNITE_API ~data_streamer();
+
+    /**
+     * Adds a record.
+     *
+     * Blocks if the maximum number of pending rows is reached until some of them are written.
+     *
+     * @param record Record.
+     * @throw ignite_error If the streamer is closed or failed to write some of the rows.
+     */
+    IGNITE_API void add(ignite_tuple record);
+
+    /**
+     * Adds a record given as separate key and value tuples.
+     *
+     * Blocks if the maximum number of pending rows is reached until some of them are written.
+     *
+     * @param key Key.
+     * @param value Value.
+     * @throw ignite_error If the streamer is closed or failed to write some of the rows.
+     */
+    IGNITE_API void add(ignite_tuple key, ignite_tuple value);
+
+    /**
+     * Adds a record.
+     *
+     * Template function @c convert_to_tuple() should be specialized for the type T.
+     *
+     * @param record Record.
+     * @throw ignite_error If the streamer is closed or failed to write some of the rows.
+     */
+    template<typename T>
+    void add(const T &record) {
+        add(convert_to_tuple(record));
+    }
+
+    /**
+     * Adds a record given as separate key and value.
+     *
+     * Template function @c convert_to_tuple() should be specialized for the types K and V.
+     *
+     * @param key Key.
+     * @param value Value.
+     * @throw ignite_error If the streamer is closed or failed to write some of the rows.
+     */
+    template<typename K, typename V>
+    void add(const K &key, const V &value) {
+        add(convert_to_tuple(key), convert_to_tuple(value));
+    }
+
+    /**
+     * Sends all the buffered rows and waits until all the rows added so far are written asynchronously.
+     *
+     * @param callback Callback which is called with an error if any of the rows failed to be written.
+     */
+    IGNITE_API void flush_async(ignite_callback<void> callback);
+
+    /**
+     * Sends all the buffered rows and waits until all the rows added so far are written.
+     *
+     * @throw ignite_error If any of the rows failed to be written.
+     */
+    IGNITE_API void flush() {
+        sync<void>([this](auto callback) { flush_async(std::move(callback)); });
+    }
+
+    /**
+     * Stops accepting new rows and waits until all the rows are written asynchronously.
+     *
+     * @param callback Callback which is called with an error if any of the rows failed to be written.
+     */
+    IGNITE_API void close_async(ignite_callback<void> callback);
+
+    /**
+     * Stops accepting new rows and waits until all the rows are written.
+     *
+     * @throw ignite_error If any of the rows failed to be written.
+     */
+    IGNITE_API void close() {
+        sync<void>([this](auto callback) { close_async(std::move(callback)); });
+    }
+
+    /**
+     * Gets the streaming progress.
+     *
+     * @return Progress.
+     */
+    [[nodiscard]] IGNITE_API data_streamer_progress progress() const;
+
+private:
+    /**
+     * Constructor
+     *
+     * @param impl Implementation
+     */
+    explicit data_streamer(std::shared_ptr<detail::data_streamer_impl> impl)
+        : m_impl(std::move(impl)) {}
+
+    /** Implementation. */
+    std::shared_ptr<detail::data_streamer_impl> m_impl;
+};
+
+} // namespace ignite
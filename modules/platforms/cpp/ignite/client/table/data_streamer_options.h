@@ -0,0 +1,170 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/table/data_streamer_progress.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ignite {
+
+/**
+ * Data streamer options.
+ */
+class data_streamer_options {
+public:
+    /** Default number of rows per batch. */
+    static constexpr std::int32_t DEFAULT_PAGE_SIZE{1000};
+
+    /** Default maximum number of batches being written at the same time. */
+    static constexpr std::int32_t DEFAULT_PARALLEL_OPERATIONS{4};
+
+    /** Default maximum number of rows which are buffered or being written. */
+    static constexpr std::size_t DEFAULT_MAX_PENDING_ROWS{100000};
+
+    /** Default interval after which a non-full batch is sent anyway. */
+    static constexpr std::chrono::milliseconds DEFAULT_AUTO_FLUSH_INTERVAL{5000};
+
+    /** Default maximum number of retries of a failed batch. */
+    static constexpr std::int32_t DEFAULT_RETRY_LIMIT{16};
+
+    // Default
+    data_streamer_options() = default;
+
+    /**
+     * Gets the number of rows per batch.
+     *
+     * @return Number of rows per batch.
+     */
+    [[nodiscard]] std::int32_t page_size() const { return m_page_size; }
+
+    /**
+     * Sets the number of rows per batch.
+     *
+     * @param val Number of rows per batch.
+     */
+    void page_size(std::int32_t val) { m_page_size = val; }
+
+    /**
+     * Gets the maximum number of batches being written at the same time.
+     *
+     * @return Maximum number of batches being written at the same time.
+     */
+    [[nodiscard]] std::int32_t parallel_operations() const { return m_parallel_operations; }
+
+    /**
+     * Sets the maximum number of batches being written at the same time.
+     *
+     * Batches are spread over all the connections of the client, so this value should normally be a multiple of
+     * the number of nodes in the cluster.
+     *
+     * @param val Maximum number of batches being written at the same time.
+     */
+    void parallel_operations(std::int32_t val) { m_parallel_operations = val; }
+
+    /**
+     * Gets the maximum number of rows which are buffered or being written.
+     *
+     * @return Maximum number of pending rows.
+     */
+    [[nodiscard]] std::size_t max_pending_rows() const { return m_max_pending_rows; }
+
+    /**
+     * Sets the maximum number of rows which are buffered or being written.
+     *
+     * When the limit is reached, adding a row blocks until some of the pending rows are written.
+     *
+     * @param val Maximum number of pending rows.
+     */
+    void max_pending_rows(std::size_t val) { m_max_pending_rows = val; }
+
+    /**
+     * Gets the interval after which a non-full batch is sent anyway (zero means that only full batches are sent
+     * before an explicit flush).
+     *
+     * @return Auto flush interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds auto_flush_interval() const { return m_auto_flush_interval; }
+
+    /**
+     * Sets the interval after which a non-full batch is sent anyway (zero means that only full batches are sent
+     * before an explicit flush).
+     *
+     * @param val Auto flush interval.
+     */
+    void auto_flush_interval(std::chrono::milliseconds val) { m_auto_flush_interval = val; }
+
+    /**
+     * Gets the maximum number of retries of a failed batch.
+     *
+     * @return Maximum number of retries.
+     */
+    [[nodiscard]] std::int32_t retry_limit() const { return m_retry_limit; }
+
+    /**
+     * Sets the maximum number of retries of a failed batch.
+     *
+     * @param val Maximum number of retries.
+     */
+    void retry_limit(std::int32_t val) { m_retry_limit = val; }
+
+    /**
+     * Gets the progress handler.
+     *
+     * @return Progress handler.
+     */
+    [[nodiscard]] const std::function<void(const data_streamer_progress &)> &progress_handler() const {
+        return m_progress_handler;
+    }
+
+    /**
+     * Sets the progress handler.
+     *
+     * The handler is called from a network thread after each batch is completed, so it should return quickly. Flush and
+     * close complete only after the handler was called for every batch they cover.
+     *
+     * @param val Progress handler.
+     */
+    void progress_handler(std::function<void(const data_streamer_progress &)> val) {
+        m_progress_handler = std::move(val);
+    }
+
+private:
+    /** Page size. */
+    std::int32_t m_page_size{DEFAULT_PAGE_SIZE};
+
+    /** Parallel operations. */
+    std::int32_t m_parallel_operations{DEFAULT_PARALLEL_OPERATIONS};
+
+    /** Maximum number of pending rows. */
+    std::size_t m_max_pending_rows{DEFAULT_MAX_PENDING_ROWS};
+
+    /** Auto flush interval. */
+    std::chrono::milliseconds m_auto_flush_interval{DEFAULT_AUTO_FLUSH_INTERVAL};
+
+    /** Retry limit. */
+    std::int32_t m_retry_limit{DEFAULT_RETRY_LIMIT};
+
+    /** Progress handler. */
+    std::function<void(const data_streamer_progress &)> m_progress_handler;
+};
+
+} // namespace ignite
@@ -0,0 +1,51 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Progress of a data streamer.
+ */
+struct data_streamer_progress {
+    /** Number of rows added to the streamer. */
+    std::int64_t rows_added{0};
+
+    /** Number of rows successfully written to the table. */
+    std::int64_t rows_streamed{0};
+
+    /** Number of rows which could not be written even after all the retries. */
+    std::int64_t rows_failed{0};
+
+    /** Number of successfully written batches. */
+    std::int64_t batches_streamed{0};
+
+    /** Number of batch send retries. */
+    std::int64_t batches_retried{0};
+
+    /**
+     * Gets the number of rows which are buffered or being written at the moment.
+     *
+     * @return Number of pending rows.
+     */
+    [[nodiscard]] std::int64_t rows_pending() const { return rows_added - rows_streamed - rows_failed; }
+};
+
+} // namespace ignite
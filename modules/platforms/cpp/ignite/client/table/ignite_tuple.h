@@ -18,9 +18,15 @@
 #pragma once
 
 #include "ignite/client/primitive.h"
+#include "ignite/common/bytes_view.h"
 #include "ignite/common/ignite_error.h"
 
+#include <atomic>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
@@ -31,14 +37,204 @@ namespace ignite {
 class ignite_tuple;
 
 namespace detail {
-ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right);
-}
+class tuple_writer;
+
+/**
+ * Source of column values for tuples which are decoded lazily.
+ *
+ * A single source usually holds multiple rows received in a single response.
+ */
+class tuple_source {
+public:
+    /** Encoder of a column value of a row straight into a binary tuple. */
+    typedef void (*encoder)(tuple_writer &writer, const tuple_source &source, std::size_t row, std::int32_t scale);
+
+    // Default
+    tuple_source() = default;
+
+    /**
+     * Destructor.
+     */
+    virtual ~tuple_source() { delete m_decoded.load(std::memory_order_relaxed); }
+
+    tuple_source(const tuple_source &) = delete;
+    tuple_source &operator=(const tuple_source &) = delete;
+
+    /**
+     * Gets a number of rows.
+     *
+     * @return Number of rows.
+     */
+    [[nodiscard]] virtual std::size_t row_count() const = 0;
+
+    /**
+     * Gets a number of columns in every row.
+     *
+     * @return Number of columns.
+     */
+    [[nodiscard]] virtual std::int32_t column_count() const = 0;
+
+    /**
+     * Gets the name of the column.
+     *
+     * @param idx The column index.
+     * @return Column name.
+     */
+    [[nodiscard]] virtual const std::string &column_name(std::int32_t idx) const = 0;
+
+    /**
+     * Gets the type of the column.
+     *
+     * @param idx The column index.
+     * @return Column type.
+     */
+    [[nodiscard]] virtual ignite_type column_type(std::int32_t idx) const = 0;
+
+    /**
+     * Gets the column ordinal given the normalized name of the column.
+     *
+     * @param parsed_name Normalized column name.
+     * @return Column index or -1 if there is no such column.
+     */
+    [[nodiscard]] virtual std::int32_t column_ordinal(const std::string &parsed_name) const = 0;
+
+    /**
+     * Decode the value of the column.
+     *
+     * @param row The row index.
+     * @param idx The column index.
+     * @return Column value.
+     */
+    [[nodiscard]] virtual primitive get(std::size_t row, std::int32_t idx) const = 0;
+
+    /**
+     * Gets the encoded value of the column without decoding it.
+     *
+     * @param row The row index.
+     * @param idx The column index.
+     * @return Encoded column value or @c std::nullopt if the value is null. Stays valid as long as the source exists.
+     */
+    [[nodiscard]] virtual std::optional<bytes_view> get_raw(std::size_t row, std::int32_t idx) const = 0;
+
+    /**
+     * Gets the value of the column, decoding it on the first access.
+     *
+     * Decoded values are cached by the source and shared by all the tuples backed by it, so the method can be called
+     * concurrently. Rows can not be added to the source once any value is decoded this way.
+     *
+     * @param row The row index.
+     * @param idx The column index.
+     * @return Column value. Stays valid as long as the source exists.
+     */
+    [[nodiscard]] const primitive &get_decoded(std::size_t row, std::int32_t idx) const;
+
+    /**
+     * Gets encoders which write column values into a binary tuple directly, without converting them to
+     * @c primitive first.
+     *
+     * @return Pointer to an array with an encoder per column, or @c nullptr if the source does not support direct
+     *  encoding. The same pointer is returned by all the sources of the same layout.
+     */
+    [[nodiscard]] virtual const encoder *encoders() const { return nullptr; }
+
+    /**
+     * Gets the hash of the normalized column names of the rows, in the column order.
+     *
+     * @return Shape hash. Equal to the shape hash of a regular tuple with the same columns.
+     */
+    [[nodiscard]] virtual std::size_t shape_hash() const;
+
+    /**
+     * Gets the source the tuple is backed by.
+     *
+     * @param tuple Tuple.
+     * @return Source and the row index in it, or @c nullptr if the tuple is not backed by a source.
+     */
+    [[nodiscard]] static std::pair<const tuple_source *, std::size_t> get_source(const ignite_tuple &tuple);
+
+    /**
+     * Gets the hash of the normalized column names of the tuple, in the column order.
+     *
+     * Tuples of the same shape have the same hash, so it can be used to look up data cached for the shape without
+     * comparing column names.
+     *
+     * @param tuple Tuple.
+     * @return Shape hash.
+     */
+    [[nodiscard]] static std::size_t get_shape_hash(const ignite_tuple &tuple);
+
+    /**
+     * Add a column to the shape hash.
+     *
+     * @param hash Shape hash of the preceding columns.
+     * @param parsed_name Normalized column name.
+     * @return Shape hash.
+     */
+    [[nodiscard]] static std::size_t add_to_shape_hash(std::size_t hash, const std::string &parsed_name);
+
+    /**
+     * Normalize column name the same way tuple does it.
+     *
+     * @param name The column name.
+     * @return Normalized column name.
+     */
+    [[nodiscard]] static std::string parse_name(std::string_view name);
+
+protected:
+    /**
+     * Values decoded from the source, allocated on the first access.
+     */
+    struct decoded_values {
+        /**
+         * Constructor.
+         *
+         * @param size Number of values.
+         */
+        explicit decoded_values(std::size_t size)
+            : values(new std::atomic<const primitive *>[size]())
+            , size(size) {}
+
+        /**
+         * Destructor.
+         */
+        ~decoded_values() {
+            for (std::size_t i = 0; i < size; ++i)
+                delete values[i].load(std::memory_order_relaxed);
+        }
+
+        /** Values, one per column of every row, or @c nullptr for values which are not decoded yet. */
+        std::unique_ptr<std::atomic<const primitive *>[]> values;
+
+        /** Number of values. */
+        const std::size_t size;
+    };
+
+    /**
+     * Make a tuple backed by the source.
+     *
+     * @param source Source.
+     * @param row The row index.
+     * @return Tuple.
+     */
+    [[nodiscard]] static ignite_tuple make_tuple(std::shared_ptr<const tuple_source> source, std::size_t row);
+
+private:
+    /** Decoded values. */
+    mutable std::atomic<decoded_values *> m_decoded{nullptr};
+};
+
+} // namespace detail
 
 /**
  * Ignite tuple.
+ *
+ * Tuples returned by table operations are backed by the received binary data and decode column values only when
+ * they are accessed. Decoded values are shared by all the copies of such a tuple, so it can be read from multiple
+ * threads concurrently. Such a tuple is converted to a regular one on the first modification, and as with any
+ * other tuple, modifying it concurrently with other accesses requires external synchronization.
  */
 class ignite_tuple {
-    friend ignite_tuple detail::concat(const ignite_tuple &left, const ignite_tuple &right);
+    friend class detail::tuple_source;
 
 public:
     // Default
@@ -63,8 +259,11 @@ public:
         : m_pairs(pairs)
         , m_indices() {
         m_indices.reserve(pairs.size());
-        for (size_t i = 0; i < m_pairs.size(); ++i)
-            m_indices.emplace(std::make_pair(parse_name(m_pairs[i].first), i));
+        for (size_t i = 0; i < m_pairs.size(); ++i) {
+            auto parsed_name = parse_name(m_pairs[i].first);
+            m_shape_hash = add_to_shape_hash(m_shape_hash, parsed_name);
+            m_indices.emplace(std::move(parsed_name), i);
+        }
     }
 
     /**
@@ -72,7 +271,9 @@ public:
      *
      * @return Number of columns in the tuple.
      */
-    [[nodiscard]] std::int32_t column_count() const noexcept { return std::int32_t(m_pairs.size()); }
+    [[nodiscard]] std::int32_t column_count() const noexcept {
+        return m_source ? m_source->column_count() : std::int32_t(m_pairs.size());
+    }
 
     /**
      * Gets the value of the specified column.
@@ -81,10 +282,11 @@ public:
      * @return Column value.
      */
     [[nodiscard]] const primitive &get(uint32_t idx) const {
-        if (idx > m_pairs.size()) {
-            throw ignite_error(
-                "Index is too large: idx=" + std::to_string(idx) + ", columns_num=" + std::to_string(m_pairs.size()));
-        }
+        check_index(idx);
+
+        if (m_source)
+            return get_lazy(idx);
+
         return m_pairs[idx].second;
     }
 
@@ -109,10 +311,9 @@ public:
      */
     template<typename T>
     void set(uint32_t idx, T &&value) {
-        if (idx > m_pairs.size()) {
-            throw ignite_error(
-                "Index is too large: idx=" + std::to_string(idx) + ", columns_num=" + std::to_string(m_pairs.size()));
-        }
+        check_index(idx);
+        materialize();
+
         m_pairs[idx].second = std::forward<T>(value);
     }
 
@@ -122,13 +323,7 @@ public:
      * @param name The column name.
      * @return Column value.
      */
-    [[nodiscard]] const primitive &get(std::string_view name) const {
-        auto it = m_indices.find(parse_name(name));
-        if (it == m_indices.end())
-            throw ignite_error("Can not find column with the name '" + std::string(name) + "' in the tuple");
-        auto idx = it->second;
-        return m_pairs[idx].second;
-    }
+    [[nodiscard]] const primitive &get(std::string_view name) const { return get(get_ordinal_checked(name)); }
 
     /**
      * Gets the value of the specified column.
@@ -142,6 +337,51 @@ public:
         return get(name).template get<T>();
     }
 
+    /**
+     * Gets the value of the specified string column without copying it.
+     *
+     * For tuples returned by table and SQL operations, the resulting view points directly into the received data.
+     * The view stays valid as long as this tuple (or any copy of it) exists and is not modified.
+     *
+     * @param idx The column index.
+     * @return Column value.
+     */
+    [[nodiscard]] std::string_view get_string_view(uint32_t idx) const {
+        auto bytes = get_raw_view(idx, ignite_type::STRING);
+        return {reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+    }
+
+    /**
+     * Gets the value of the specified string column without copying it.
+     *
+     * @param name The column name.
+     * @return Column value.
+     */
+    [[nodiscard]] std::string_view get_string_view(std::string_view name) const {
+        return get_string_view(get_ordinal_checked(name));
+    }
+
+    /**
+     * Gets the value of the specified byte array column without copying it.
+     *
+     * For tuples returned by table and SQL operations, the resulting view points directly into the received data.
+     * The view stays valid as long as this tuple (or any copy of it) exists and is not modified.
+     *
+     * @param idx The column index.
+     * @return Column value.
+     */
+    [[nodiscard]] bytes_view get_bytes_view(uint32_t idx) const { return get_raw_view(idx, ignite_type::BYTE_ARRAY); }
+
+    /**
+     * Gets the value of the specified byte array column without copying it.
+     *
+     * @param name The column name.
+     * @return Column value.
+     */
+    [[nodiscard]] bytes_view get_bytes_view(std::string_view name) const {
+        return get_bytes_view(get_ordinal_checked(name));
+    }
+
     /**
      * Sets the value of the specified column.
      *
@@ -151,6 +391,8 @@ public:
      */
     template<typename T>
     void set(std::string_view name, T &&value) {
+        materialize();
+
         auto parsed_name = parse_name(name);
         auto it = m_indices.find(parsed_name);
         if (it != m_indices.end()) {
@@ -160,7 +402,8 @@ public:
         }
 
         m_pairs.emplace_back(name, std::forward<T>(value));
-        m_indices.emplace(parsed_name, m_pairs.size() - 1);
+        m_shape_hash = add_to_shape_hash(m_shape_hash, parsed_name);
+        m_indices.emplace(std::move(parsed_name), m_pairs.size() - 1);
     }
 
     /**
@@ -170,10 +413,11 @@ public:
      * @return Column name.
      */
     [[nodiscard]] const std::string &column_name(uint32_t idx) const {
-        if (idx > m_pairs.size()) {
-            throw ignite_error(
-                "Index is too large: idx=" + std::to_string(idx) + ", columns_num=" + std::to_string(m_pairs.size()));
-        }
+        check_index(idx);
+
+        if (m_source)
+            return m_source->column_name(std::int32_t(idx));
+
         return m_pairs[idx].first;
     }
 
@@ -185,6 +429,9 @@ public:
      * @return Column index.
      */
     [[nodiscard]] std::int32_t column_ordinal(std::string_view name) const {
+        if (m_source)
+            return m_source->column_ordinal(parse_name(name));
+
         auto it = m_indices.find(parse_name(name));
         if (it == m_indices.end())
             return -1;
@@ -195,13 +442,116 @@ private:
     /**
      * Constructor.
      *
-     * @param pairs Pairs.
-     * @param indices Indices.
+     * @param source Source of the column values.
+     * @param row The row index in the source.
+     */
+    ignite_tuple(std::shared_ptr<const detail::tuple_source> source, std::size_t row)
+        : m_source(std::move(source))
+        , m_row(row) {}
+
+    /**
+     * Check that the column index is valid.
+     *
+     * @param idx The column index.
+     */
+    void check_index(uint32_t idx) const {
+        auto columns_num = std::size_t(column_count());
+        if (idx >= columns_num) {
+            throw ignite_error(
+                "Index is too large: idx=" + std::to_string(idx) + ", columns_num=" + std::to_string(columns_num));
+        }
+    }
+
+    /**
+     * Gets the column ordinal given the name of the column, throwing if there is no such column.
+     *
+     * @param name The column name.
+     * @return Column index.
      */
-    ignite_tuple(
-        std::vector<std::pair<std::string, primitive>> &&pairs, std::unordered_map<std::string, size_t> indices)
-        : m_pairs(std::move(pairs))
-        , m_indices(std::move(indices)) {}
+    [[nodiscard]] std::uint32_t get_ordinal_checked(std::string_view name) const {
+        auto idx = column_ordinal(name);
+        if (idx < 0)
+            throw ignite_error("Can not find column with the name '" + std::string(name) + "' in the tuple");
+
+        return std::uint32_t(idx);
+    }
+
+    /**
+     * Gets a view of the string or byte array column value.
+     *
+     * @param idx The column index.
+     * @param typ Expected column type.
+     * @return Column value.
+     */
+    [[nodiscard]] bytes_view get_raw_view(uint32_t idx, ignite_type typ) const {
+        check_index(idx);
+
+        if (m_source) {
+            if (m_source->column_type(std::int32_t(idx)) != typ)
+                throw ignite_error("Column type mismatch: idx=" + std::to_string(idx));
+
+            auto raw = m_source->get_raw(m_row, std::int32_t(idx));
+            if (!raw)
+                throw ignite_error("Column value is null: idx=" + std::to_string(idx));
+
+            return *raw;
+        }
+
+        const auto &value = get(idx);
+        if (value.is_null())
+            throw ignite_error("Column value is null: idx=" + std::to_string(idx));
+
+        if (value.get_type() != typ)
+            throw ignite_error("Column type mismatch: idx=" + std::to_string(idx));
+
+        if (typ == ignite_type::STRING)
+            return {value.get<std::string>().data(), value.get<std::string>().size()};
+
+        return {value.get<std::vector<std::byte>>().data(), value.get<std::vector<std::byte>>().size()};
+    }
+
+    /**
+     * Gets the value of the specified column from the source, decoding it on the first access.
+     *
+     * @param idx The column index.
+     * @return Column value.
+     */
+    [[nodiscard]] const primitive &get_lazy(uint32_t idx) const {
+        return m_source->get_decoded(m_row, std::int32_t(idx));
+    }
+
+    /**
+     * Decode all the columns from the source, so the tuple can be modified.
+     */
+    void materialize() {
+        if (!m_source)
+            return;
+
+        auto columns_num = m_source->column_count();
+        m_pairs.reserve(std::size_t(columns_num));
+        m_indices.reserve(std::size_t(columns_num));
+        for (std::int32_t i = 0; i < columns_num; ++i) {
+            const auto &name = m_source->column_name(i);
+            m_pairs.emplace_back(name, get_lazy(std::uint32_t(i)));
+
+            auto parsed_name = parse_name(name);
+            m_shape_hash = add_to_shape_hash(m_shape_hash, parsed_name);
+            m_indices.emplace(std::move(parsed_name), std::size_t(i));
+        }
+
+        m_source.reset();
+    }
+
+    /**
+     * Add a column to the shape hash.
+     *
+     * @param hash Shape hash of the preceding columns.
+     * @param parsed_name Normalized column name.
+     * @return Shape hash.
+     */
+    [[nodiscard]] static std::size_t add_to_shape_hash(std::size_t hash, const std::string &parsed_name) {
+        return hash ^ (std::hash<std::string>{}(parsed_name) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+    }
 
     /**
      * Normalize column name.
@@ -231,6 +581,68 @@ private:
 
     /** Indices of the columns corresponding to their names. */
     std::unordered_map<std::string, std::size_t> m_indices;
+
+    /** Hash of the normalized column names, in the column order. Only maintained for tuples without a source. */
+    std::size_t m_shape_hash{0};
+
+    /** Source of the column values for a tuple which is not decoded yet. */
+    std::shared_ptr<const detail::tuple_source> m_source;
+
+    /** The row index in the source. */
+    std::size_t m_row{0};
 };
 
+namespace detail {
+
+inline ignite_tuple tuple_source::make_tuple(std::shared_ptr<const tuple_source> source, std::size_t row) {
+    return {std::move(source), row};
+}
+
+inline std::pair<const tuple_source *, std::size_t> tuple_source::get_source(const ignite_tuple &tuple) {
+    return {tuple.m_source.get(), tuple.m_row};
+}
+
+inline const primitive &tuple_source::get_decoded(std::size_t row, std::int32_t idx) const {
+    auto decoded = m_decoded.load(std::memory_order_acquire);
+    if (!decoded) {
+        auto created = std::make_unique<decoded_values>(row_count() * std::size_t(column_count()));
+        if (m_decoded.compare_exchange_strong(decoded, created.get(), std::memory_order_acq_rel))
+            decoded = created.release();
+    }
+
+    auto &slot = decoded->values[row * std::size_t(column_count()) + std::size_t(idx)];
+    auto value = slot.load(std::memory_order_acquire);
+    if (value)
+        return *value;
+
+    // Concurrent first accesses may decode the same value, but only one of the results is kept.
+    auto created = std::make_unique<const primitive>(get(row, idx));
+    if (slot.compare_exchange_strong(value, created.get(), std::memory_order_acq_rel))
+        value = created.release();
+
+    return *value;
+}
+
+inline std::string tuple_source::parse_name(std::string_view name) {
+    return ignite_tuple::parse_name(name);
+}
+
+inline std::size_t tuple_source::add_to_shape_hash(std::size_t hash, const std::string &parsed_name) {
+    return ignite_tuple::add_to_shape_hash(hash, parsed_name);
+}
+
+inline std::size_t tuple_source::shape_hash() const {
+    std::size_t hash = 0;
+    for (std::int32_t i = 0; i < column_count(); ++i)
+        hash = add_to_shape_hash(hash, parse_name(column_name(i)));
+
+    return hash;
+}
+
+inline std::size_t tuple_source::get_shape_hash(const ignite_tuple &tuple) {
+    return tuple.m_source ? tuple.m_source->shape_hash() : tuple.m_shape_hash;
+}
+
+} // namespace detail
+
 } // namespace ignite
@@ -17,26 +17,11 @@
 
 #include "ignite/client/table/key_value_view.h"
 #include "ignite/client/detail/argument_check_utils.h"
+#include "ignite/client/detail/table/data_streamer_impl.h"
 #include "ignite/client/detail/table/table_impl.h"
 
 namespace ignite {
 
-/**
- * Process multiple kv pairs by uniting key and value part of the tuple
- * to a single record.
- *
- * @param pairs Pairs.
- */
-std::vector<ignite_tuple> concat_records(const std::vector<std::pair<ignite_tuple, ignite_tuple>> &pairs) {
-    // TODO: IGNITE-18855 eliminate unnecessary tuple transformation;
-    std::vector<ignite_tuple> records;
-    records.reserve(pairs.size());
-    for (const auto &pair : pairs)
-        records.emplace_back(detail::concat(pair.first, pair.second));
-
-    return records;
-}
-
 void key_value_view<ignite_tuple, ignite_tuple>::get_async(
     transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<value_type>> callback) {
     detail::arg_check::key_tuple_non_empty(key);
@@ -49,7 +34,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::put_async(
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->upsert_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->put_async(tx, key, value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::get_all_async(
@@ -76,7 +61,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::put_all_async(
         return;
     }
 
-    m_impl->upsert_all_async(tx, concat_records(pairs), std::move(callback));
+    m_impl->put_all_async(tx, pairs, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::get_and_put_async(transaction *tx, const key_type &key,
@@ -84,7 +69,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::get_and_put_async(transaction *
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->get_and_upsert_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->get_and_put_async(tx, key, value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::put_if_absent_async(
@@ -92,7 +77,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::put_if_absent_async(
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->insert_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->put_if_absent_async(tx, key, value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::remove_async(
@@ -107,7 +92,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::remove_async(
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->remove_exact_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->remove_exact_async(tx, key, value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::remove_all_async(
@@ -127,7 +112,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::remove_all_async(transaction *t
         return;
     }
 
-    m_impl->remove_all_exact_async(tx, concat_records(pairs), std::move(callback));
+    m_impl->remove_all_exact_async(tx, pairs, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::get_and_remove_async(
@@ -142,7 +127,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::replace_async(
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->replace_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->replace_value_async(tx, key, value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::replace_async(transaction *tx, const key_type &key,
@@ -151,7 +136,7 @@ void key_value_view<ignite_tuple, ignite_tuple>::replace_async(transaction *tx,
     detail::arg_check::value_tuple_non_empty(old_value);
     detail::arg_check::value_tuple_non_empty(new_value);
 
-    m_impl->replace_async(tx, detail::concat(key, old_value), detail::concat(key, new_value), std::move(callback));
+    m_impl->replace_value_async(tx, key, old_value, new_value, std::move(callback));
 }
 
 void key_value_view<ignite_tuple, ignite_tuple>::get_and_replace_async(transaction *tx, const key_type &key,
@@ -159,7 +144,11 @@ void key_value_view<ignite_tuple, ignite_tuple>::get_and_replace_async(transacti
     detail::arg_check::key_tuple_non_empty(key);
     detail::arg_check::value_tuple_non_empty(value);
 
-    m_impl->get_and_replace_async(tx, detail::concat(key, value), std::move(callback));
+    m_impl->get_and_replace_value_async(tx, key, value, std::move(callback));
+}
+
+data_streamer key_value_view<ignite_tuple, ignite_tuple>::get_streamer(const data_streamer_options &options) {
+    return data_streamer{detail::data_streamer_impl::create(m_impl, options)};
 }
 
 } // namespace ignite
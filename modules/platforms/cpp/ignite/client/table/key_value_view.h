@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "ignite/client/table/data_streamer.h"
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/client/transaction/transaction.h"
 #include "ignite/client/type_mapping.h"
@@ -468,6 +469,14 @@ public:
             [this, tx, &key, &value](auto callback) { get_and_replace_async(tx, key, value, std::move(callback)); });
     }
 
+    /**
+     * Creates a data streamer which writes key-value pairs into the table in batches.
+     *
+     * @param options Streamer options.
+     * @return New data streamer.
+     */
+    [[nodiscard]] IGNITE_API data_streamer get_streamer(const data_streamer_options &options = {});
+
 private:
     /**
      * Constructor
@@ -954,6 +963,16 @@ public:
         return sync<std::optional<value_type>>(
             [this, tx, &key, &value](auto callback) { get_and_replace_async(tx, key, value, std::move(callback)); });
     }
+    /**
+     * Creates a data streamer which writes key-value pairs into the table in batches.
+     *
+     * @param options Streamer options.
+     * @return New data streamer.
+     */
+    [[nodiscard]] data_streamer get_streamer(const data_streamer_options &options = {}) {
+        return m_delegate.get_streamer(options);
+    }
+
 private:
     /**
      * Constructor
@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace ignite {
+
+/**
+ * Near cache options.
+ *
+ * The near cache keeps rows read outside of transactions on the client, so repeated reads of the same keys do not
+ * go to the server. It is invalidated by writes of this client only, so changes made by other clients are only
+ * seen after the entry expires.
+ */
+class near_cache_options {
+public:
+    /** Default maximum size of the cached rows in bytes. */
+    static constexpr std::size_t DEFAULT_MAX_SIZE_BYTES{16 * 1024 * 1024};
+
+    /** Default entry time to live. */
+    static constexpr std::chrono::milliseconds DEFAULT_TTL{10000};
+
+    // Default
+    near_cache_options() = default;
+
+    /**
+     * Gets the maximum size of the cached keys and rows in bytes.
+     *
+     * @return Maximum size in bytes.
+     */
+    [[nodiscard]] std::size_t max_size_bytes() const { return m_max_size_bytes; }
+
+    /**
+     * Sets the maximum size of the cached keys and rows in bytes.
+     *
+     * When the limit is reached, the least recently used entries are evicted. The size is computed from the
+     * encoded binary tuples, so it does not include the bookkeeping overhead of the cache.
+     *
+     * @param val Maximum size in bytes.
+     */
+    void max_size_bytes(std::size_t val) { m_max_size_bytes = val; }
+
+    /**
+     * Gets the entry time to live (zero means that entries do not expire).
+     *
+     * @return Entry time to live.
+     */
+    [[nodiscard]] std::chrono::milliseconds ttl() const { return m_ttl; }
+
+    /**
+     * Sets the entry time to live (zero means that entries do not expire).
+     *
+     * @param val Entry time to live.
+     */
+    void ttl(std::chrono::milliseconds val) { m_ttl = val; }
+
+private:
+    /** Maximum size in bytes. */
+    std::size_t m_max_size_bytes{DEFAULT_MAX_SIZE_BYTES};
+
+    /** Entry time to live. */
+    std::chrono::milliseconds m_ttl{DEFAULT_TTL};
+};
+
+} // namespace ignite
@@ -0,0 +1,51 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Near cache statistics.
+ */
+struct near_cache_statistics {
+    /** Number of lookups served from the cache. */
+    std::int64_t hits{0};
+
+    /** Number of lookups which had to go to the server. */
+    std::int64_t misses{0};
+
+    /** Number of entries evicted to stay within the size limit. */
+    std::int64_t evictions{0};
+
+    /** Number of entries dropped because their time to live has passed. */
+    std::int64_t expirations{0};
+
+    /** Number of entries dropped because of writes of this client. */
+    std::int64_t invalidations{0};
+
+    /** Number of cached entries. */
+    std::size_t entry_count{0};
+
+    /** Size of the cached keys and rows in bytes. */
+    std::size_t size_bytes{0};
+};
+
+} // namespace ignite
@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Read coalescing options.
+ *
+ * With read coalescing, single-key @c get and @c contains calls made outside of transactions are sent as a single
+ * batched request. A call is sent right away if fewer than @c max_batches_in_flight batches are being processed.
+ * Otherwise it waits until one of them completes, together with the other calls made meanwhile, so the batches
+ * grow with the load and idle callers do not pay any extra latency.
+ */
+class read_coalescing_options {
+public:
+    /** Default maximum number of keys in a batch. */
+    static constexpr std::int32_t DEFAULT_MAX_BATCH_SIZE{64};
+
+    /** Default maximum number of batches being processed at the same time. */
+    static constexpr std::int32_t DEFAULT_MAX_BATCHES_IN_FLIGHT{2};
+
+    // Default
+    read_coalescing_options() = default;
+
+    /**
+     * Gets the maximum number of keys in a batch.
+     *
+     * @return Maximum number of keys in a batch.
+     */
+    [[nodiscard]] std::int32_t max_batch_size() const { return m_max_batch_size; }
+
+    /**
+     * Sets the maximum number of keys in a batch. A batch which reaches this size is sent even if the maximum
+     * number of batches is already being processed.
+     *
+     * @param val Maximum number of keys in a batch.
+     */
+    void max_batch_size(std::int32_t val) { m_max_batch_size = val; }
+
+    /**
+     * Gets the maximum number of batches being processed at the same time.
+     *
+     * @return Maximum number of batches in flight.
+     */
+    [[nodiscard]] std::int32_t max_batches_in_flight() const { return m_max_batches_in_flight; }
+
+    /**
+     * Sets the maximum number of batches being processed at the same time.
+     *
+     * @param val Maximum number of batches in flight.
+     */
+    void max_batches_in_flight(std::int32_t val) { m_max_batches_in_flight = val; }
+
+private:
+    /** Maximum number of keys in a batch. */
+    std::int32_t m_max_batch_size{DEFAULT_MAX_BATCH_SIZE};
+
+    /** Maximum number of batches in flight. */
+    std::int32_t m_max_batches_in_flight{DEFAULT_MAX_BATCHES_IN_FLIGHT};
+};
+
+} // namespace ignite
@@ -17,6 +17,7 @@
 
 #include "ignite/client/table/record_view.h"
 #include "ignite/client/detail/argument_check_utils.h"
+#include "ignite/client/detail/table/data_streamer_impl.h"
 #include "ignite/client/detail/table/table_impl.h"
 
 namespace ignite {
@@ -141,4 +142,8 @@ void record_view<ignite_tuple>::remove_all_exact_async(
     m_impl->remove_all_exact_async(tx, std::move(records), std::move(callback));
 }
 
+data_streamer record_view<ignite_tuple>::get_streamer(const data_streamer_options &options) {
+    return data_streamer{detail::data_streamer_impl::create(m_impl, options)};
+}
+
 } // namespace ignite
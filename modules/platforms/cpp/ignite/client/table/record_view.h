@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <ignite/client/table/data_streamer.h>
 #include <ignite/client/table/ignite_tuple.h>
 #include <ignite/client/transaction/transaction.h>
 #include <ignite/client/type_mapping.h>
@@ -449,6 +450,14 @@ public:
         });
     }
 
+    /**
+     * Creates a data streamer which writes records into the table in batches.
+     *
+     * @param options Streamer options.
+     * @return New data streamer.
+     */
+    [[nodiscard]] IGNITE_API data_streamer get_streamer(const data_streamer_options &options = {});
+
 private:
     /**
      * Constructor
@@ -922,6 +931,16 @@ public:
         });
     }
 
+    /**
+     * Creates a data streamer which writes records into the table in batches.
+     *
+     * @param options Streamer options.
+     * @return New data streamer.
+     */
+    [[nodiscard]] data_streamer get_streamer(const data_streamer_options &options = {}) {
+        return m_delegate.get_streamer(options);
+    }
+
 private:
     /**
      * Constructor
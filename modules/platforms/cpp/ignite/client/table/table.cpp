@@ -32,4 +32,36 @@ key_value_view<ignite_tuple, ignite_tuple> table::get_key_value_binary_view() co
     return key_value_view<ignite_tuple, ignite_tuple>{m_impl};
 }
 
+void table::enable_near_cache(const near_cache_options &options) {
+    m_impl->enable_near_cache(options);
+}
+
+void table::disable_near_cache() {
+    m_impl->disable_near_cache();
+}
+
+near_cache_statistics table::get_near_cache_statistics() const {
+    return m_impl->get_near_cache_statistics();
+}
+
+void table::enable_read_coalescing(const read_coalescing_options &options) {
+    m_impl->enable_read_coalescing(options);
+}
+
+void table::disable_read_coalescing() {
+    m_impl->disable_read_coalescing();
+}
+
+void table::enable_read_deduplication() {
+    m_impl->enable_read_deduplication();
+}
+
+void table::disable_read_deduplication() {
+    m_impl->disable_read_deduplication();
+}
+
+std::int64_t table::get_deduplicated_read_count() const {
+    return m_impl->get_deduplicated_read_count();
+}
+
 } // namespace ignite
@@ -19,9 +19,13 @@
 
 #include "ignite/client/table/ignite_tuple.h"
 #include "ignite/client/table/key_value_view.h"
+#include "ignite/client/table/near_cache_options.h"
+#include "ignite/client/table/near_cache_statistics.h"
+#include "ignite/client/table/read_coalescing_options.h"
 #include "ignite/client/table/record_view.h"
 #include "ignite/common/config.h"
 
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -98,6 +102,63 @@ public:
         return key_value_view<K, V>{get_key_value_binary_view()};
     }
 
+    /**
+     * Enables the near cache for the table, replacing the current one if any.
+     *
+     * The cache is shared by all the views of the table. It serves @c get, @c get_all and @c contains performed
+     * outside of transactions, and it is invalidated by the writes of this client.
+     *
+     * @param options Near cache options.
+     */
+    IGNITE_API void enable_near_cache(const near_cache_options &options = {});
+
+    /**
+     * Disables the near cache for the table.
+     */
+    IGNITE_API void disable_near_cache();
+
+    /**
+     * Gets the near cache statistics.
+     *
+     * @return Statistics. All zeroes if the near cache is disabled.
+     */
+    [[nodiscard]] IGNITE_API near_cache_statistics get_near_cache_statistics() const;
+
+    /**
+     * Enables read coalescing for the table, replacing the current settings if any.
+     *
+     * Single-key @c get and @c contains calls made outside of transactions through any view of the table are then
+     * sent in batches. If the near cache is enabled as well, the batched keys are looked up in it.
+     *
+     * @param options Read coalescing options.
+     */
+    IGNITE_API void enable_read_coalescing(const read_coalescing_options &options = {});
+
+    /**
+     * Disables read coalescing for the table.
+     */
+    IGNITE_API void disable_read_coalescing();
+
+    /**
+     * Enables deduplication of identical reads for the table.
+     *
+     * A @c get or @c contains call made outside of transactions while an identical call for the same key is in
+     * flight does not send a request, but gets the result of the call in flight.
+     */
+    IGNITE_API void enable_read_deduplication();
+
+    /**
+     * Disables deduplication of identical reads for the table.
+     */
+    IGNITE_API void disable_read_deduplication();
+
+    /**
+     * Gets the number of reads which got the result of an identical read in flight.
+     *
+     * @return Number of deduplicated reads.
+     */
+    [[nodiscard]] IGNITE_API std::int64_t get_deduplicated_read_count() const;
+
 private:
     /**
      * Constructor
@@ -0,0 +1,115 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace ignite {
+
+/**
+ * Transaction options.
+ */
+class transaction_options {
+public:
+    /** Default transaction timeout (zero means no timeout). */
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{0};
+
+    /** Default maximum number of buffered writes per table (zero means that the writes are not buffered). */
+    static constexpr std::size_t DEFAULT_WRITE_BUFFER_LIMIT{0};
+
+    // Default
+    transaction_options() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param read_only Read-only flag.
+     * @param timeout Timeout.
+     */
+    explicit transaction_options(bool read_only, std::chrono::milliseconds timeout = DEFAULT_TIMEOUT)
+        : m_read_only(read_only)
+        , m_timeout(timeout) {}
+
+    /**
+     * Gets the read-only flag.
+     *
+     * @return @c true if the transaction is read-only.
+     */
+    [[nodiscard]] bool read_only() const { return m_read_only; }
+
+    /**
+     * Sets the read-only flag.
+     *
+     * Read-only transactions provide a snapshot view of data at a certain point in time. They are lock-free and
+     * perform better than normal transactions, but do not permit data modifications.
+     *
+     * @param val Read-only flag.
+     */
+    void read_only(bool val) { m_read_only = val; }
+
+    /**
+     * Gets the transaction timeout (zero means no timeout).
+     *
+     * @return Transaction timeout (zero means no timeout).
+     */
+    [[nodiscard]] std::chrono::milliseconds timeout() const { return m_timeout; }
+
+    /**
+     * Sets the transaction timeout (zero means no timeout).
+     *
+     * The timeout is counted from the moment the transaction is started. Once it is expired, the transaction is
+     * rolled back and any further operation or commit within it fails.
+     *
+     * @param val Transaction timeout (zero means no timeout).
+     */
+    void timeout(std::chrono::milliseconds val) { m_timeout = val; }
+
+    /**
+     * Gets the maximum number of buffered writes per table (zero means that the writes are not buffered).
+     *
+     * @return Maximum number of buffered writes per table.
+     */
+    [[nodiscard]] std::size_t write_buffer_limit() const { return m_write_buffer_limit; }
+
+    /**
+     * Sets the maximum number of buffered writes per table (zero means that the writes are not buffered).
+     *
+     * When set, upserts within the transaction complete immediately and are kept on the client. They are sent to
+     * the server in a single batch per table when the limit is reached, and before any other operation within the
+     * transaction, including commit, so that the operation observes them. An error of such a batch fails the
+     * operations waiting for it and any further operation or commit within the transaction. A commit failed this
+     * way rolls the transaction back. Otherwise, it is rolled back by an explicit rollback or when the transaction
+     * is destroyed.
+     *
+     * @param val Maximum number of buffered writes per table.
+     */
+    void write_buffer_limit(std::size_t val) { m_write_buffer_limit = val; }
+
+private:
+    /** Read-only flag. */
+    bool m_read_only{false};
+
+    /** Timeout. */
+    std::chrono::milliseconds m_timeout{DEFAULT_TIMEOUT};
+
+    /** Maximum number of buffered writes per table. */
+    std::size_t m_write_buffer_limit{DEFAULT_WRITE_BUFFER_LIMIT};
+};
+
+} // namespace ignite
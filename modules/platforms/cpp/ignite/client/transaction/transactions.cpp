@@ -21,7 +21,11 @@
 namespace ignite {
 
 void transactions::begin_async(ignite_callback<transaction> callback) {
-    m_impl->begin_async(std::move(callback));
+    m_impl->begin_async({}, std::move(callback));
+}
+
+void transactions::begin_async(const transaction_options &options, ignite_callback<transaction> callback) {
+    m_impl->begin_async(options, std::move(callback));
 }
 
 } // namespace ignite
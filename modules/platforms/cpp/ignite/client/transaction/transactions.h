@@ -18,6 +18,7 @@
 #pragma once
 
 #include "ignite/client/transaction/transaction.h"
+#include "ignite/client/transaction/transaction_options.h"
 
 #include "ignite/common/config.h"
 #include "ignite/common/ignite_result.h"
@@ -56,6 +57,24 @@ public:
      */
     IGNITE_API void begin_async(ignite_callback<transaction> callback);
 
+    /**
+     * Starts a new transaction with the specified options.
+     *
+     * @param options Transaction options.
+     * @return A new transaction.
+     */
+    IGNITE_API transaction begin(const transaction_options &options) {
+        return sync<transaction>([this, &options](auto callback) { begin_async(options, std::move(callback)); });
+    }
+
+    /**
+     * Starts a new transaction with the specified options asynchronously.
+     *
+     * @param options Transaction options.
+     * @param callback Callback to be called with a new transaction or error upon completion of asynchronous operation.
+     */
+    IGNITE_API void begin_async(const transaction_options &options, ignite_callback<transaction> callback);
+
 private:
     /**
      * Constructor
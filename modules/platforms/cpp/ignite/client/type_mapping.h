@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <ignite/client/detail/struct_source.h>
+#include <ignite/client/struct_mapping.h>
 #include <ignite/client/table/ignite_tuple.h>
 
 namespace ignite {
@@ -44,13 +46,18 @@ T convert_from_tuple(ignite_tuple &&value);
 /**
  * Specialisation for const-references.
  *
+ * Types with a struct mapping are converted by the generated serializer, and do not need a specialisation.
+ *
  * @tparam T Type to convert from.
  * @param value Value.
  * @return Tuple.
  */
 template<typename T>
 ignite_tuple convert_to_tuple(const T &value) {
-    return convert_to_tuple(T(value));
+    if constexpr (struct_mapping<T>::mapped)
+        return detail::struct_source<T>::to_tuple(value);
+    else
+        return convert_to_tuple(T(value));
 }
 
 /**
@@ -65,7 +72,10 @@ std::optional<ignite_tuple> convert_to_tuple(std::optional<T> &&value) {
     if (!value.has_value())
         return std::nullopt;
 
-    return {convert_to_tuple<T>(*std::move(value))};
+    if constexpr (struct_mapping<T>::mapped)
+        return {detail::struct_source<T>::to_tuple(*std::move(value))};
+    else
+        return {convert_to_tuple<T>(*std::move(value))};
 }
 
 /**
@@ -80,7 +90,10 @@ std::optional<T> convert_from_tuple(std::optional<ignite_tuple> &&value) {
     if (!value.has_value())
         return std::nullopt;
 
-    return {convert_from_tuple<T>(*std::move(value))};
+    if constexpr (struct_mapping<T>::mapped)
+        return {typename detail::struct_source<T>::decoder().decode(*value)};
+    else
+        return {convert_from_tuple<T>(*std::move(value))};
 }
 
 } // namespace ignite
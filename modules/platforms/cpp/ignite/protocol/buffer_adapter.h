@@ -49,6 +49,19 @@ public:
      */
     void write_raw(bytes_view data) { m_buffer.insert(m_buffer.end(), data.begin(), data.end()); }
 
+    /**
+     * Reserve space for raw data to be written in place.
+     *
+     * @param size Size of the data.
+     * @return Pointer to the reserved space. Valid until the next write to the buffer.
+     */
+    [[nodiscard]] std::byte *reserve_raw(std::size_t size) {
+        auto pos = m_buffer.size();
+        m_buffer.resize(pos + size);
+
+        return m_buffer.data() + pos;
+    }
+
     /**
      * Get underlying data buffer view.
      *
@@ -17,6 +17,11 @@
 
 #include "ignite/protocol/writer.h"
 
+#include "ignite/common/ignite_error.h"
+
+#include <limits>
+#include <string>
+
 namespace ignite::protocol {
 
 int writer::write_callback(void *data, const char *buf, size_t len) {
@@ -35,4 +40,26 @@ int writer::write_callback(void *data, const char *buf, size_t len) {
     return 0;
 }
 
+std::byte *writer::reserve_binary(std::size_t size) {
+    // We do not support messages larger than MAX_INT32
+    if (m_buffer.data().size() + size > std::size_t(std::numeric_limits<int32_t>::max()))
+        throw ignite_error("Message is too large: " + std::to_string(m_buffer.data().size() + size));
+
+    msgpack_pack_bin(m_packer.get(), std::uint32_t(size));
+
+    return m_buffer.reserve_raw(size);
+}
+
+std::size_t writer::reserve_int64() {
+    // MsgPack "int 64" format marker.
+    static constexpr std::byte INT64_MARKER{0xd3};
+
+    m_buffer.write_raw(bytes_view{&INT64_MARKER, 1});
+
+    auto offset = m_buffer.data().size();
+    (void) m_buffer.reserve_raw(sizeof(std::int64_t));
+
+    return offset;
+}
+
 } // namespace ignite::protocol
@@ -124,6 +124,31 @@ public:
      */
     void write_binary(bytes_view data) { msgpack_pack_bin_with_body(m_packer.get(), data.data(), data.size()); }
 
+    /**
+     * Write binary data header and reserve space for the data to be written in place by the caller.
+     *
+     * @param size Size of the binary data.
+     * @return Pointer to the reserved space. Valid until the next write.
+     */
+    [[nodiscard]] std::byte *reserve_binary(std::size_t size);
+
+    /**
+     * Write raw data which is already in MsgPack format.
+     *
+     * @param data Data to write.
+     */
+    void write_raw(bytes_view data) { m_buffer.write_raw(data); }
+
+    /**
+     * Write int64 header and reserve space for a big-endian value to be patched in later by the caller.
+     *
+     * Unlike write(std::int64_t) this always uses the full 9-byte encoding, so the value can be filled in once it
+     * is known without changing the message layout.
+     *
+     * @return Offset of the reserved 8 bytes from the start of the underlying buffer.
+     */
+    [[nodiscard]] std::size_t reserve_int64();
+
     /**
      * Write empty map.
      */
@@ -20,14 +20,13 @@
 
 #include <ignite/common/bytes.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
 namespace ignite {
 
-namespace {
-
-void store_date(std::byte *dest, const ignite_date &value) {
+void binary_tuple_builder::store_date(std::byte *dest, const ignite_date &value) {
     auto year = value.get_year();
     auto month = value.get_month();
     auto day = value.get_day_of_month();
@@ -38,7 +37,7 @@ void store_date(std::byte *dest, const ignite_date &value) {
     bytes::store<endian::LITTLE>(dest + 2, std::uint8_t(date >> 16));
 }
 
-void store_time(std::byte *dest, const ignite_time &value, std::size_t size) {
+void binary_tuple_builder::store_time(std::byte *dest, const ignite_time &value, std::size_t size) {
     std::uint64_t hour = value.get_hour();
     std::uint64_t minute = value.get_minute();
     std::uint64_t second = value.get_second();
@@ -58,7 +57,21 @@ void store_time(std::byte *dest, const ignite_time &value, std::size_t size) {
     }
 }
 
-} // namespace
+void binary_tuple_builder::store_period(std::byte *dest, const ignite_period &value, std::size_t size) {
+    if (size == 3) {
+        bytes::store<endian::LITTLE>(dest, std::uint8_t(value.get_years()));
+        bytes::store<endian::LITTLE>(dest + 1, std::uint8_t(value.get_months()));
+        bytes::store<endian::LITTLE>(dest + 2, std::uint8_t(value.get_days()));
+    } else if (size == 6) {
+        bytes::store<endian::LITTLE>(dest, std::uint16_t(value.get_years()));
+        bytes::store<endian::LITTLE>(dest + 2, std::uint16_t(value.get_months()));
+        bytes::store<endian::LITTLE>(dest + 4, std::uint16_t(value.get_days()));
+    } else {
+        bytes::store<endian::LITTLE>(dest, value.get_years());
+        bytes::store<endian::LITTLE>(dest + 4, value.get_months());
+        bytes::store<endian::LITTLE>(dest + 8, value.get_days());
+    }
+}
 
 binary_tuple_builder::binary_tuple_builder(tuple_num_t element_count) noexcept
     : element_count(element_count) {
@@ -69,9 +82,52 @@ void binary_tuple_builder::start() noexcept {
     null_elements = 0;
     value_area_size = 0;
     entry_size = 0;
+    single_pass = false;
+}
+
+void binary_tuple_builder::start_single_pass() {
+    start();
+    single_pass = true;
+
+    if (scratch_values.empty())
+        scratch_values.resize(INITIAL_SCRATCH_SIZE);
+
+    value_base = scratch_values.data();
+    next_value = value_base;
+
+    scratch_offsets.clear();
+    scratch_offsets.reserve(std::size_t(element_count));
+
+    scratch_nullmap.assign(binary_tuple_common::get_nullmap_size(element_count), std::byte{0});
+}
+
+std::size_t binary_tuple_builder::get_tuple_size() const noexcept {
+    assert(element_index == element_count);
+
+    auto value_size = single_pass ? tuple_size_t(next_value - value_base) : value_area_size;
+
+    binary_tuple_common::header header;
+
+    std::size_t nullmap_size = 0;
+    if (null_elements)
+        nullmap_size = binary_tuple_common::get_nullmap_size(element_count);
+
+    std::size_t table_size = header.set_entry_size(value_size) * element_count;
+
+    return binary_tuple_common::HEADER_SIZE + nullmap_size + table_size + value_size;
 }
 
 void binary_tuple_builder::layout() {
+    assert(!single_pass);
+
+    binary_tuple.clear();
+    binary_tuple.resize(get_tuple_size());
+
+    layout(binary_tuple.data());
+}
+
+void binary_tuple_builder::layout(std::byte *data) {
+    assert(!single_pass);
     assert(element_index == element_count);
 
     binary_tuple_common::header header;
@@ -86,21 +142,71 @@ void binary_tuple_builder::layout() {
 
     std::size_t tableSize = entry_size * element_count;
 
-    binary_tuple.clear();
-    binary_tuple.resize(binary_tuple_common::HEADER_SIZE + nullmapSize + tableSize + value_area_size);
-
-    binary_tuple[0] = header.flags;
+    tuple_data = data;
+    tuple_data[0] = header.flags;
+    std::memset(tuple_data + binary_tuple_common::HEADER_SIZE, 0, nullmapSize);
 
-    next_entry = binary_tuple.data() + binary_tuple_common::HEADER_SIZE + nullmapSize;
+    next_entry = tuple_data + binary_tuple_common::HEADER_SIZE + nullmapSize;
     value_base = next_entry + tableSize;
     next_value = value_base;
 
     element_index = 0;
 }
 
+const std::vector<std::byte> &binary_tuple_builder::build() {
+    assert(element_index == element_count);
+
+    if (single_pass) {
+        binary_tuple.resize(get_tuple_size());
+        build(binary_tuple.data());
+    }
+
+    return binary_tuple;
+}
+
+void binary_tuple_builder::build(std::byte *data) {
+    assert(single_pass);
+    assert(element_index == element_count);
+
+    value_area_size = tuple_size_t(next_value - value_base);
+
+    binary_tuple_common::header header;
+
+    std::size_t nullmap_size = 0;
+    if (null_elements) {
+        header.set_nullmap_flag();
+        nullmap_size = scratch_nullmap.size();
+    }
+
+    entry_size = header.set_entry_size(value_area_size);
+
+    data[0] = header.flags;
+    std::byte *pos = data + binary_tuple_common::HEADER_SIZE;
+
+    if (nullmap_size) {
+        std::memcpy(pos, scratch_nullmap.data(), nullmap_size);
+        pos += nullmap_size;
+    }
+
+    for (auto offset : scratch_offsets) {
+        auto entry = bytes::htol<std::ptrdiff_t>(offset);
+        std::memcpy(pos, &entry, entry_size);
+        pos += entry_size;
+    }
+
+    std::memcpy(pos, value_base, value_area_size);
+}
+
+void binary_tuple_builder::grow_scratch(tuple_size_t size) {
+    auto used = std::size_t(next_value - value_base);
+    scratch_values.resize(std::max(used + size, scratch_values.size() * 2));
+
+    value_base = scratch_values.data();
+    next_value = value_base + used;
+}
+
 void binary_tuple_builder::append_bytes(bytes_view bytes) {
-    assert(element_index < element_count);
-    assert(next_value + bytes.size() <= value_base + value_area_size);
+    reserve_value(tuple_size_t(bytes.size()));
     std::memcpy(next_value, bytes.data(), bytes.size());
     next_value += bytes.size();
     append_entry();
@@ -188,8 +294,7 @@ void binary_tuple_builder::append_int64_ptr(std::int64_t *bytes) {
 void binary_tuple_builder::append_float(float value) {
     tuple_size_t size = gauge_float(value);
 
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == sizeof(float));
@@ -202,8 +307,7 @@ void binary_tuple_builder::append_float(float value) {
 
 void binary_tuple_builder::append_double(double value) {
     tuple_size_t size = gauge_double(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         if (size == sizeof(float)) {
@@ -221,8 +325,7 @@ void binary_tuple_builder::append_double(double value) {
 
 void binary_tuple_builder::append_number(const big_integer &value) {
     tuple_size_t size = gauge_number(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         value.store_bytes(next_value);
@@ -234,8 +337,7 @@ void binary_tuple_builder::append_number(const big_integer &value) {
 
 void binary_tuple_builder::append_number(const big_decimal &value) {
     tuple_size_t size = gauge_number(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         value.get_unscaled_value().store_bytes(next_value);
@@ -247,8 +349,7 @@ void binary_tuple_builder::append_number(const big_decimal &value) {
 
 void binary_tuple_builder::append_uuid(uuid value) {
     tuple_size_t size = gauge_uuid(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == 16);
@@ -262,8 +363,7 @@ void binary_tuple_builder::append_uuid(uuid value) {
 
 void binary_tuple_builder::append_date(const ignite_date &value) {
     tuple_size_t size = gauge_date(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == 3);
@@ -276,8 +376,7 @@ void binary_tuple_builder::append_date(const ignite_date &value) {
 
 void binary_tuple_builder::append_time(const ignite_time &value) {
     tuple_size_t size = gauge_time(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(4 <= size && size <= 6);
@@ -290,8 +389,7 @@ void binary_tuple_builder::append_time(const ignite_time &value) {
 
 void binary_tuple_builder::append_date_time(const ignite_date_time &value) {
     tuple_size_t size = gauge_date_time(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(7 <= size && size <= 9);
@@ -305,8 +403,7 @@ void binary_tuple_builder::append_date_time(const ignite_date_time &value) {
 
 void binary_tuple_builder::append_timestamp(const ignite_timestamp &value) {
     tuple_size_t size = gauge_timestamp(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == 8 || size == 12);
@@ -322,24 +419,11 @@ void binary_tuple_builder::append_timestamp(const ignite_timestamp &value) {
 
 void binary_tuple_builder::append_period(const ignite_period &value) {
     tuple_size_t size = gauge_period(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == 3 || size == 6 || size == 12);
-        if (size == 3) {
-            bytes::store<endian::LITTLE>(next_value, std::uint8_t(value.get_years()));
-            bytes::store<endian::LITTLE>(next_value + 1, std::uint8_t(value.get_months()));
-            bytes::store<endian::LITTLE>(next_value + 2, std::uint8_t(value.get_days()));
-        } else if (size == 6) {
-            bytes::store<endian::LITTLE>(next_value, std::uint16_t(value.get_years()));
-            bytes::store<endian::LITTLE>(next_value + 2, std::uint16_t(value.get_months()));
-            bytes::store<endian::LITTLE>(next_value + 4, std::uint16_t(value.get_days()));
-        } else {
-            bytes::store<endian::LITTLE>(next_value, value.get_years());
-            bytes::store<endian::LITTLE>(next_value + 4, value.get_months());
-            bytes::store<endian::LITTLE>(next_value + 8, value.get_days());
-        }
+        store_period(next_value, value, size);
         next_value += size;
     }
 
@@ -348,8 +432,7 @@ void binary_tuple_builder::append_period(const ignite_period &value) {
 
 void binary_tuple_builder::append_duration(const ignite_duration &value) {
     tuple_size_t size = gauge_duration(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size != 0) {
         assert(size == 8 || size == 12);
@@ -37,9 +37,20 @@
 #include <limits>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace ignite {
 
+namespace detail {
+
+template<typename T>
+struct static_tuple_element;
+
+template<typename T>
+struct static_tuple_integer;
+
+} // namespace detail
+
 /**
  * @brief Binary tuple builder.
  *
@@ -57,8 +68,28 @@ namespace ignite {
  * 4. Supply all elements again with one or more @ref append calls in the same
  *    order with the same values.
  * 5. Finally, the resulting binary tuple is obtained with the @ref build call.
+ *
+ * Alternatively, the tuple can be built in place in a caller-provided memory. In this case the size of the tuple
+ * is obtained with the @ref get_tuple_size call after all elements are claimed, and the layout is determined with
+ * the @ref layout(std::byte*) call. After all elements are appended the tuple is complete in the provided memory, and
+ * the @ref build call is not needed.
+ *
+ * The builder also supports a single-pass mode, started with the @ref start_single_pass call. In this mode elements
+ * are supplied only once with the @ref append calls, and the @ref claim and @ref layout calls are not used. Values
+ * are written to a scratch area while their offsets are recorded, and the @ref build call assembles the tuple with
+ * the narrowest offset table entry size. To build the tuple in place, the @ref build(std::byte*) call is used with
+ * the memory of at least @ref get_tuple_size bytes.
  */
 class binary_tuple_builder {
+    template<typename T>
+    friend struct detail::static_tuple_element;
+
+    template<typename T>
+    friend struct detail::static_tuple_integer;
+
+    /** Initial size of the scratch value area used in the single-pass mode. */
+    static constexpr std::size_t INITIAL_SCRATCH_SIZE = 256;
+
     const tuple_num_t element_count; /**< Total number of elements. */
 
     tuple_num_t element_index; /**< Index of the next element to add. */
@@ -75,8 +106,18 @@ class binary_tuple_builder {
 
     std::byte *next_value; /**< Position for the next value. */
 
+    std::byte *tuple_data; /**< Position of the tuple. */
+
     std::vector<std::byte> binary_tuple; /**< Internal buffer for tuple generation. */
 
+    bool single_pass{false}; /**< Single-pass mode flag. */
+
+    std::vector<std::byte> scratch_values; /**< Value area of the tuple built in the single-pass mode. */
+
+    std::vector<tuple_size_t> scratch_offsets; /**< Value end offsets of the tuple built in the single-pass mode. */
+
+    std::vector<std::byte> scratch_nullmap; /**< Nullmap of the tuple built in the single-pass mode. */
+
 public:
     /**
      * @brief Constructs a new Tuple Builder object.
@@ -90,6 +131,11 @@ public:
      */
     void start() noexcept;
 
+    /**
+     * @brief Starts a new tuple in the single-pass mode.
+     */
+    void start_single_pass();
+
     /**
      * @brief Assigns a null value for the next element.
      */
@@ -236,19 +282,41 @@ public:
      */
     void claim_duration(const ignite_duration &value) noexcept { claim(gauge_duration(value)); }
 
+    /**
+     * @brief Gets the size of the binary tuple.
+     *
+     * Can only be called after all elements are claimed.
+     *
+     * @return Size of the resulting binary tuple in bytes.
+     */
+    [[nodiscard]] std::size_t get_tuple_size() const noexcept;
+
     /**
      * @brief Performs binary tuple layout.
      */
     void layout();
 
+    /**
+     * @brief Performs binary tuple layout in the specified memory.
+     *
+     * @param data Memory to build the tuple in. Must be at least @ref get_tuple_size bytes long.
+     */
+    void layout(std::byte *data);
+
     /**
      * @brief Appends a null value for the next element.
      */
     void append(std::nullopt_t /*null*/) {
-        assert(null_elements > 0);
         assert(element_index < element_count);
-        binary_tuple[binary_tuple_common::get_null_offset(element_index)] |=
-            binary_tuple_common::get_null_mask(element_index);
+        if (single_pass) {
+            null_elements++;
+            scratch_nullmap[binary_tuple_common::get_null_offset(element_index) - binary_tuple_common::HEADER_SIZE] |=
+                binary_tuple_common::get_null_mask(element_index);
+        } else {
+            assert(null_elements > 0);
+            tuple_data[binary_tuple_common::get_null_offset(element_index)] |=
+                binary_tuple_common::get_null_mask(element_index);
+        }
         append_entry();
     }
 
@@ -451,10 +519,14 @@ public:
      *
      * @return Byte buffer with binary tuple.
      */
-    const std::vector<std::byte> &build() {
-        assert(element_index == element_count);
-        return binary_tuple;
-    }
+    const std::vector<std::byte> &build();
+
+    /**
+     * @brief Finalizes a binary tuple built in the single-pass mode in the specified memory.
+     *
+     * @param data Memory to build the tuple in. Must be at least @ref get_tuple_size bytes long.
+     */
+    void build(std::byte *data);
 
 private:
     /**
@@ -676,15 +748,67 @@ private:
         return value == ignite_duration() ? 0 : value.get_nano() == 0 ? 8 : 12;
     }
 
+    /**
+     * @brief Writes a date value.
+     *
+     * @param dest Destination memory.
+     * @param value Date value.
+     */
+    static void store_date(std::byte *dest, const ignite_date &value);
+
+    /**
+     * @brief Writes a time value.
+     *
+     * @param dest Destination memory.
+     * @param value Time value.
+     * @param size Size of the value as computed by @ref gauge_time.
+     */
+    static void store_time(std::byte *dest, const ignite_time &value, std::size_t size);
+
+    /**
+     * @brief Writes a period value.
+     *
+     * @param dest Destination memory.
+     * @param value Period value.
+     * @param size Size of the value as computed by @ref gauge_period.
+     */
+    static void store_period(std::byte *dest, const ignite_period &value, std::size_t size);
+
     /**
      * @brief Adds an entry to the offset table.
      */
     void append_entry() {
-        auto offset = bytes::htol<std::ptrdiff_t>(next_value - value_base);
-        std::memcpy(next_entry, &offset, entry_size);
-        next_entry += entry_size;
+        if (single_pass) {
+            scratch_offsets.push_back(tuple_size_t(next_value - value_base));
+        } else {
+            auto offset = bytes::htol<std::ptrdiff_t>(next_value - value_base);
+            std::memcpy(next_entry, &offset, entry_size);
+            next_entry += entry_size;
+        }
         element_index++;
     }
+
+    /**
+     * @brief Makes sure there is space for the next value.
+     *
+     * @param size Size of the value.
+     */
+    void reserve_value(tuple_size_t size) {
+        assert(element_index < element_count);
+        if (single_pass) {
+            if (next_value + size > scratch_values.data() + scratch_values.size())
+                grow_scratch(size);
+        } else {
+            assert(next_value + size <= value_base + value_area_size);
+        }
+    }
+
+    /**
+     * @brief Grows the scratch value area to fit the next value.
+     *
+     * @param size Size of the value.
+     */
+    void grow_scratch(tuple_size_t size);
 };
 
 } // namespace ignite
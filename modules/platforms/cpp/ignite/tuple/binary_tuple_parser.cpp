@@ -23,6 +23,14 @@
 #include <cstring>
 #include <stdexcept>
 
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define IGNITE_TUPLE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define IGNITE_TUPLE_SSE2
+#endif
+
 namespace ignite {
 
 namespace {
@@ -71,6 +79,70 @@ ignite_time load_time(bytes_view bytes) {
     return {hour, minute, second, nano};
 }
 
+/**
+ * Widens 1-byte offset table entries to 4-byte ones, as many as it is possible with SIMD instructions.
+ *
+ * @param src Offset table.
+ * @param dst Resulting offsets.
+ * @param count Number of entries.
+ * @return Number of widened entries.
+ */
+std::size_t widen_offsets_8(const std::byte *src, tuple_size_t *dst, std::size_t count) noexcept {
+    std::size_t i = 0;
+#if defined(IGNITE_TUPLE_AVX2)
+    for (; i + 8 <= count; i += 8) {
+        __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu8_epi32(in));
+    }
+#elif defined(IGNITE_TUPLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i lo = _mm_unpacklo_epi8(in, zero);
+        __m128i hi = _mm_unpackhi_epi8(in, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+#else
+    (void) src;
+    (void) dst;
+    (void) count;
+#endif
+    return i;
+}
+
+/**
+ * Widens 2-byte little-endian offset table entries to 4-byte ones, as many as it is possible with SIMD instructions.
+ *
+ * @param src Offset table.
+ * @param dst Resulting offsets.
+ * @param count Number of entries.
+ * @return Number of widened entries.
+ */
+std::size_t widen_offsets_16(const std::byte *src, tuple_size_t *dst, std::size_t count) noexcept {
+    std::size_t i = 0;
+#if defined(IGNITE_TUPLE_AVX2)
+    for (; i + 8 <= count; i += 8) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu16_epi32(in));
+    }
+#elif defined(IGNITE_TUPLE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi16(in, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(in, zero));
+    }
+#else
+    (void) src;
+    (void) dst;
+    (void) count;
+#endif
+    return i;
+}
+
 } // namespace
 
 binary_tuple_parser::binary_tuple_parser(tuple_num_t num_elements, bytes_view data)
@@ -92,7 +164,8 @@ binary_tuple_parser::binary_tuple_parser(tuple_num_t num_elements, bytes_view da
     }
 
     tuple_size_t table_size = entry_size * element_count;
-    next_entry = binary_tuple.data() + binary_tuple_common::HEADER_SIZE + nullmap_size;
+    entry_base = binary_tuple.data() + binary_tuple_common::HEADER_SIZE + nullmap_size;
+    next_entry = entry_base;
     value_base = next_entry + table_size;
 
     if (value_base > binary_tuple.data() + binary_tuple.size()) {
@@ -138,6 +211,50 @@ std::optional<bytes_view> binary_tuple_parser::get_next() {
     return bytes_view(value, length);
 }
 
+std::optional<bytes_view> binary_tuple_parser::get(tuple_num_t index) const {
+    assert(index >= 0 && index < num_elements());
+
+    tuple_size_t begin = index ? load_entry(index - 1) : 0;
+    tuple_size_t end = load_entry(index);
+
+    if (begin == end && is_null(index)) {
+        return {};
+    }
+
+    return bytes_view(value_base + begin, end - begin);
+}
+
+bool binary_tuple_parser::is_null(tuple_num_t index) const noexcept {
+    using namespace ignite::binary_tuple_common;
+
+    return has_nullmap && (binary_tuple[get_null_offset(index)] & get_null_mask(index)) != std::byte{0};
+}
+
+void binary_tuple_parser::decode_offsets(tuple_size_t *ends) const noexcept {
+    auto count = std::size_t(element_count);
+    std::size_t i = 0;
+
+    if constexpr (is_little_endian_platform()) {
+        switch (entry_size) {
+            case 1:
+                i = widen_offsets_8(entry_base, ends, count);
+                break;
+            case 2:
+                i = widen_offsets_16(entry_base, ends, count);
+                break;
+            case 4:
+                std::memcpy(ends, entry_base, count * sizeof(tuple_size_t));
+                return;
+            default:
+                break;
+        }
+    }
+
+    for (; i < count; ++i) {
+        ends[i] = load_entry(tuple_num_t(i));
+    }
+}
+
 bool binary_tuple_parser::get_bool(bytes_view bytes) {
     switch (bytes.size()) {
         case 0:
@@ -30,6 +30,9 @@
 #include <ignite/common/ignite_timestamp.h>
 #include <ignite/common/uuid.h>
 
+#include <ignite/common/bytes.h>
+
+#include <cstring>
 #include <optional>
 
 namespace ignite {
@@ -38,6 +41,8 @@ namespace ignite {
  * @brief Binary tuple parser.
  *
  * A tuple parser is used to parse a binary tuple with a given schema.
+ *
+ * Elements can be read either sequentially with the @ref get_next call, or in any order with the @ref get call.
  */
 class binary_tuple_parser {
     bytes_view binary_tuple; /**< The binary tuple to parse. */
@@ -50,6 +55,8 @@ class binary_tuple_parser {
 
     tuple_size_t entry_size; /**< Size of an offset table entry. */
 
+    const std::byte *entry_base; /**< Position of the offset table. */
+
     const std::byte *next_entry; /**< Position of the next offset table entry. */
 
     const std::byte *value_base; /**< Position of the value area. */
@@ -105,6 +112,44 @@ public:
      */
     std::optional<bytes_view> get_next();
 
+    /**
+     * @brief Gets the value of the specified element.
+     *
+     * Does not depend on and does not affect the position of the sequential parsing.
+     *
+     * @param index Element index.
+     * @return The element value.
+     */
+    [[nodiscard]] std::optional<bytes_view> get(tuple_num_t index) const;
+
+    /**
+     * @brief Checks whether the specified element is null.
+     *
+     * @param index Element index.
+     * @return @c true if the element is null.
+     */
+    [[nodiscard]] bool is_null(tuple_num_t index) const noexcept;
+
+    /**
+     * @brief Decodes the whole offset table.
+     *
+     * Widens offset table entries into an array of end offsets of the element values, relative to the value area.
+     * Element @c i occupies bytes from <tt>(i ? ends[i - 1] : 0)</tt> to @c ends[i] of the value area.
+     * Uses SIMD instructions where available.
+     *
+     * @param ends Array of at least @ref num_elements end offsets to fill.
+     */
+    void decode_offsets(tuple_size_t *ends) const noexcept;
+
+    /**
+     * @brief Gets the value area of the tuple.
+     *
+     * @return The value area.
+     */
+    [[nodiscard]] bytes_view get_value_area() const noexcept {
+        return {value_base, std::size_t(binary_tuple.data() + binary_tuple.size() - value_base)};
+    }
+
     /**
      * @brief Reads value of specified element.
      *
@@ -233,6 +278,19 @@ public:
      * @return Element value.
      */
     static ignite_duration get_duration(bytes_view bytes);
+
+private:
+    /**
+     * @brief Loads the specified offset table entry.
+     *
+     * @param index Element index.
+     * @return End offset of the element value.
+     */
+    [[nodiscard]] tuple_size_t load_entry(tuple_num_t index) const noexcept {
+        std::uint64_t le_offset = 0;
+        std::memcpy(&le_offset, entry_base + std::size_t(index) * entry_size, entry_size);
+        return tuple_size_t(bytes::ltoh(le_offset));
+    }
 };
 
 } // namespace ignite
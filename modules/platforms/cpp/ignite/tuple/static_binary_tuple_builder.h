@@ -0,0 +1,213 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "static_tuple_element.h"
+
+#include <array>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * @brief Binary tuple builder for a schema known at compile time.
+ *
+ * Element types are template parameters, so the nullmap size, the maximum value sizes and, for small fixed-size
+ * schemas, the offset table entry size are computed at compile time, and values are encoded without runtime type
+ * dispatch. Nullable elements are declared as @c std::optional. The resulting tuples are byte-for-byte identical to
+ * the ones produced by @ref binary_tuple_builder for the same values.
+ *
+ * A tuple is built with the @ref get_tuple_size call followed by the @ref build(std::byte*, const Ts&...) call with
+ * the same values, or with the single @ref build(const Ts&...) call.
+ *
+ * @tparam Ts Element types.
+ */
+template<typename... Ts>
+class static_binary_tuple_builder {
+    /** Element descriptor. */
+    template<typename T>
+    using element = detail::static_tuple_element<T>;
+
+    std::array<tuple_size_t, sizeof...(Ts)> sizes{}; /**< Sizes of the values. */
+
+    tuple_size_t value_area_size{0}; /**< Total size of all values. */
+
+    bool has_nulls{false}; /**< Whether any of the values is null. */
+
+public:
+    /** Number of elements. */
+    static constexpr tuple_num_t ELEMENT_COUNT = sizeof...(Ts);
+
+    /** Whether any of the elements may be null. */
+    static constexpr bool NULLABLE = (element<Ts>::NULLABLE || ...);
+
+    /** Whether all the elements have fixed maximum size. */
+    static constexpr bool FIXED_SIZE = ((element<Ts>::MAX_SIZE != 0) && ...);
+
+    /** Maximum size of the value area, if all the elements have fixed maximum size. */
+    static constexpr tuple_size_t MAX_VALUE_AREA_SIZE =
+        FIXED_SIZE ? (tuple_size_t(0) + ... + element<Ts>::MAX_SIZE) : 0;
+
+    /** Size of an offset table entry if it is known at compile time, zero otherwise. */
+    static constexpr tuple_size_t STATIC_ENTRY_SIZE = FIXED_SIZE && MAX_VALUE_AREA_SIZE <= UINT8_MAX ? 1 : 0;
+
+    /** Maximum size of the tuple, if all the elements have fixed maximum size. */
+    static constexpr std::size_t MAX_TUPLE_SIZE = FIXED_SIZE
+        ? binary_tuple_common::HEADER_SIZE + (NULLABLE ? binary_tuple_common::get_nullmap_size(ELEMENT_COUNT) : 0)
+            + (1u << binary_tuple_common::size_to_flags(MAX_VALUE_AREA_SIZE)) * ELEMENT_COUNT + MAX_VALUE_AREA_SIZE
+        : 0;
+
+    /**
+     * @brief Computes the size of the tuple for the given values.
+     *
+     * @param values Element values.
+     * @return Size of the resulting binary tuple in bytes.
+     */
+    std::size_t get_tuple_size(const Ts &...values) noexcept {
+        gauge(std::index_sequence_for<Ts...>{}, values...);
+
+        std::size_t nullmap_size = 0;
+        if constexpr (NULLABLE) {
+            if (has_nulls)
+                nullmap_size = binary_tuple_common::get_nullmap_size(ELEMENT_COUNT);
+        }
+
+        tuple_size_t entry_size = STATIC_ENTRY_SIZE;
+        if constexpr (!STATIC_ENTRY_SIZE) {
+            binary_tuple_common::header header;
+            entry_size = header.set_entry_size(value_area_size);
+        }
+
+        return binary_tuple_common::HEADER_SIZE + nullmap_size + entry_size * ELEMENT_COUNT + value_area_size;
+    }
+
+    /**
+     * @brief Builds the tuple in the specified memory.
+     *
+     * Must be called with the same values as the preceding @ref get_tuple_size call.
+     *
+     * @param data Memory to build the tuple in. Must be at least @ref get_tuple_size bytes long.
+     * @param values Element values.
+     */
+    void build(std::byte *data, const Ts &...values) noexcept {
+        binary_tuple_common::header header;
+        std::byte *pos = data + binary_tuple_common::HEADER_SIZE;
+
+        if constexpr (NULLABLE) {
+            if (has_nulls) {
+                header.set_nullmap_flag();
+                std::memset(pos, 0, binary_tuple_common::get_nullmap_size(ELEMENT_COUNT));
+                set_nulls(data, std::index_sequence_for<Ts...>{}, values...);
+                pos += binary_tuple_common::get_nullmap_size(ELEMENT_COUNT);
+            }
+        }
+
+        if constexpr (STATIC_ENTRY_SIZE) {
+            pos = store_offsets<STATIC_ENTRY_SIZE>(pos);
+        } else {
+            switch (header.set_entry_size(value_area_size)) {
+                case 1:
+                    pos = store_offsets<1>(pos);
+                    break;
+                case 2:
+                    pos = store_offsets<2>(pos);
+                    break;
+                default:
+                    pos = store_offsets<4>(pos);
+                    break;
+            }
+        }
+
+        data[0] = header.flags;
+
+        store_values(pos, std::index_sequence_for<Ts...>{}, values...);
+    }
+
+    /**
+     * @brief Builds the tuple.
+     *
+     * @param values Element values.
+     * @return Byte buffer with binary tuple.
+     */
+    std::vector<std::byte> build(const Ts &...values) {
+        std::vector<std::byte> tuple(get_tuple_size(values...));
+        build(tuple.data(), values...);
+        return tuple;
+    }
+
+private:
+    /**
+     * @brief Computes the sizes of the values.
+     *
+     * @param values Element values.
+     */
+    template<std::size_t... Is>
+    void gauge(std::index_sequence<Is...>, const Ts &...values) noexcept {
+        value_area_size = 0;
+        ((sizes[Is] = element<Ts>::gauge(values), value_area_size += sizes[Is]), ...);
+
+        if constexpr (NULLABLE)
+            has_nulls = (element<Ts>::is_null(values) || ...);
+    }
+
+    /**
+     * @brief Sets the nullmap bits of null values.
+     *
+     * @param data Tuple memory.
+     * @param values Element values.
+     */
+    template<std::size_t... Is>
+    static void set_nulls(std::byte *data, std::index_sequence<Is...>, const Ts &...values) noexcept {
+        ((element<Ts>::is_null(values) ? void(data[binary_tuple_common::get_null_offset(tuple_num_t(Is))] |=
+                                             binary_tuple_common::get_null_mask(tuple_num_t(Is)))
+                                       : void()),
+            ...);
+    }
+
+    /**
+     * @brief Writes the offset table.
+     *
+     * @tparam EntrySize Size of an offset table entry.
+     * @param pos Position of the offset table.
+     * @return Position of the value area.
+     */
+    template<tuple_size_t EntrySize>
+    std::byte *store_offsets(std::byte *pos) const noexcept {
+        tuple_size_t offset = 0;
+        for (auto size : sizes) {
+            offset += size;
+            auto entry = bytes::htol(offset);
+            std::memcpy(pos, &entry, EntrySize);
+            pos += EntrySize;
+        }
+        return pos;
+    }
+
+    /**
+     * @brief Writes the values.
+     *
+     * @param pos Position of the value area.
+     * @param values Element values.
+     */
+    template<std::size_t... Is>
+    void store_values(std::byte *pos, std::index_sequence<Is...>, const Ts &...values) const noexcept {
+        ((sizes[Is] != 0 ? element<Ts>::store(pos, values, sizes[Is]) : void(), pos += sizes[Is]), ...);
+    }
+};
+
+} // namespace ignite
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "static_tuple_element.h"
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace ignite {
+
+/**
+ * @brief Binary tuple parser for a schema known at compile time.
+ *
+ * Counterpart of @ref static_binary_tuple_builder. Elements are located in constant time with
+ * @ref binary_tuple_parser::get, and decoded without runtime type dispatch. Nullable elements are declared as
+ * @c std::optional; a null value of a non-nullable element is reported with an exception.
+ *
+ * @tparam Ts Element types.
+ */
+template<typename... Ts>
+class static_binary_tuple_parser {
+    binary_tuple_parser parser; /**< Underlying parser. */
+
+public:
+    /** Number of elements. */
+    static constexpr tuple_num_t ELEMENT_COUNT = sizeof...(Ts);
+
+    /** Type of the element with the specified index. */
+    template<std::size_t I>
+    using element_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    /**
+     * @brief Constructs a new parser object.
+     *
+     * @param data Binary tuple buffer.
+     */
+    explicit static_binary_tuple_parser(bytes_view data)
+        : parser(ELEMENT_COUNT, data) {}
+
+    /**
+     * @brief Gets the binary tuple size in bytes.
+     *
+     * @return Tuple size.
+     */
+    tuple_size_t get_size() const noexcept { return parser.get_size(); }
+
+    /**
+     * @brief Gets the value of the specified element.
+     *
+     * @tparam I Element index.
+     * @return The element value.
+     */
+    template<std::size_t I>
+    [[nodiscard]] element_type<I> get() const {
+        using element = detail::static_tuple_element<element_type<I>>;
+
+        auto value = parser.get(tuple_num_t(I));
+        if constexpr (element::NULLABLE) {
+            if (!value)
+                return std::nullopt;
+        } else {
+            if (!value)
+                throw std::out_of_range("Unexpected null element");
+        }
+
+        return element::load(*value);
+    }
+
+    /**
+     * @brief Gets the values of all the elements.
+     *
+     * @return The element values.
+     */
+    [[nodiscard]] std::tuple<Ts...> get_all() const { return get_all(std::index_sequence_for<Ts...>{}); }
+
+private:
+    /**
+     * @brief Gets the values of all the elements.
+     *
+     * @return The element values.
+     */
+    template<std::size_t... Is>
+    std::tuple<Ts...> get_all(std::index_sequence<Is...>) const {
+        return {get<Is>()...};
+    }
+};
+
+} // namespace ignite
@@ -0,0 +1,305 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "binary_tuple_builder.h"
+#include "binary_tuple_parser.h"
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * @brief Compile-time description of a binary tuple element of a specific C++ type.
+ *
+ * Every specialization provides:
+ * - @c NULLABLE - whether the element may be null;
+ * - @c MAX_SIZE - the maximum size of the element value, or zero for variable-length values;
+ * - @c is_null(value) - whether the value is null;
+ * - @c gauge(value) - the size of the value, exactly as @c binary_tuple_builder computes it;
+ * - @c store(dest, value, size) - writes the value of the computed size, only called for a non-zero size;
+ * - @c load(bytes) - reads the value from a non-null element.
+ *
+ * @tparam T Element type.
+ */
+template<typename T>
+struct static_tuple_element {
+    static_assert(!sizeof(T), "Unsupported binary tuple element type");
+};
+
+/**
+ * @brief Base for non-nullable element types.
+ *
+ * @tparam T Element type.
+ * @tparam MaxSize Maximum size of the value, or zero for variable-length values.
+ */
+template<typename T, tuple_size_t MaxSize>
+struct static_tuple_element_base {
+    /** Nullability of the element. */
+    static constexpr bool NULLABLE = false;
+
+    /** Maximum size of the value, or zero for variable-length values. */
+    static constexpr tuple_size_t MAX_SIZE = MaxSize;
+
+    /**
+     * @brief Checks whether the value is null.
+     *
+     * @return Always @c false.
+     */
+    static constexpr bool is_null(const T & /*value*/) noexcept { return false; }
+};
+
+/**
+ * @brief Integer element.
+ *
+ * @tparam T Integer type.
+ */
+template<typename T>
+struct static_tuple_integer : static_tuple_element_base<T, sizeof(T)> {
+    static tuple_size_t gauge(T value) noexcept {
+        if constexpr (sizeof(T) == 1)
+            return binary_tuple_builder::gauge_int8(value);
+        else if constexpr (sizeof(T) == 2)
+            return binary_tuple_builder::gauge_int16(value);
+        else if constexpr (sizeof(T) == 4)
+            return binary_tuple_builder::gauge_int32(value);
+        else
+            return binary_tuple_builder::gauge_int64(value);
+    }
+
+    static void store(std::byte *dest, T value, tuple_size_t size) noexcept {
+        // Compressed integers keep the low-order bytes of the little-endian representation.
+        value = bytes::htol(value);
+        std::memcpy(dest, &value, size);
+    }
+
+    static T load(bytes_view bytes) {
+        if constexpr (sizeof(T) == 1)
+            return binary_tuple_parser::get_int8(bytes);
+        else if constexpr (sizeof(T) == 2)
+            return binary_tuple_parser::get_int16(bytes);
+        else if constexpr (sizeof(T) == 4)
+            return binary_tuple_parser::get_int32(bytes);
+        else
+            return binary_tuple_parser::get_int64(bytes);
+    }
+};
+
+template<>
+struct static_tuple_element<std::int8_t> : static_tuple_integer<std::int8_t> {};
+
+template<>
+struct static_tuple_element<std::int16_t> : static_tuple_integer<std::int16_t> {};
+
+template<>
+struct static_tuple_element<std::int32_t> : static_tuple_integer<std::int32_t> {};
+
+template<>
+struct static_tuple_element<std::int64_t> : static_tuple_integer<std::int64_t> {};
+
+template<>
+struct static_tuple_element<bool> : static_tuple_element_base<bool, 1> {
+    static tuple_size_t gauge(bool value) noexcept { return binary_tuple_builder::gauge_bool(value); }
+
+    static void store(std::byte *dest, bool /*value*/, tuple_size_t /*size*/) noexcept { *dest = std::byte{1}; }
+
+    static bool load(bytes_view bytes) { return binary_tuple_parser::get_bool(bytes); }
+};
+
+template<>
+struct static_tuple_element<float> : static_tuple_element_base<float, sizeof(float)> {
+    static tuple_size_t gauge(float value) noexcept { return binary_tuple_builder::gauge_float(value); }
+
+    static void store(std::byte *dest, float value, tuple_size_t /*size*/) noexcept {
+        bytes::store<endian::LITTLE>(dest, value);
+    }
+
+    static float load(bytes_view bytes) { return binary_tuple_parser::get_float(bytes); }
+};
+
+template<>
+struct static_tuple_element<double> : static_tuple_element_base<double, sizeof(double)> {
+    static tuple_size_t gauge(double value) noexcept { return binary_tuple_builder::gauge_double(value); }
+
+    static void store(std::byte *dest, double value, tuple_size_t size) noexcept {
+        if (size == sizeof(float))
+            bytes::store<endian::LITTLE>(dest, static_cast<float>(value));
+        else
+            bytes::store<endian::LITTLE>(dest, value);
+    }
+
+    static double load(bytes_view bytes) { return binary_tuple_parser::get_double(bytes); }
+};
+
+template<>
+struct static_tuple_element<uuid> : static_tuple_element_base<uuid, 16> {
+    static tuple_size_t gauge(const uuid &value) noexcept { return binary_tuple_builder::gauge_uuid(value); }
+
+    static void store(std::byte *dest, const uuid &value, tuple_size_t /*size*/) noexcept {
+        bytes::store<endian::LITTLE>(dest, value.get_most_significant_bits());
+        bytes::store<endian::LITTLE>(dest + 8, value.get_least_significant_bits());
+    }
+
+    static uuid load(bytes_view bytes) { return binary_tuple_parser::get_uuid(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_date> : static_tuple_element_base<ignite_date, 3> {
+    static tuple_size_t gauge(const ignite_date &value) noexcept { return binary_tuple_builder::gauge_date(value); }
+
+    static void store(std::byte *dest, const ignite_date &value, tuple_size_t /*size*/) noexcept {
+        binary_tuple_builder::store_date(dest, value);
+    }
+
+    static ignite_date load(bytes_view bytes) { return binary_tuple_parser::get_date(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_time> : static_tuple_element_base<ignite_time, 6> {
+    static tuple_size_t gauge(const ignite_time &value) noexcept { return binary_tuple_builder::gauge_time(value); }
+
+    static void store(std::byte *dest, const ignite_time &value, tuple_size_t size) noexcept {
+        binary_tuple_builder::store_time(dest, value, size);
+    }
+
+    static ignite_time load(bytes_view bytes) { return binary_tuple_parser::get_time(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_date_time> : static_tuple_element_base<ignite_date_time, 9> {
+    static tuple_size_t gauge(const ignite_date_time &value) noexcept {
+        return binary_tuple_builder::gauge_date_time(value);
+    }
+
+    static void store(std::byte *dest, const ignite_date_time &value, tuple_size_t size) noexcept {
+        binary_tuple_builder::store_date(dest, value.date());
+        binary_tuple_builder::store_time(dest + 3, value.time(), size - 3);
+    }
+
+    static ignite_date_time load(bytes_view bytes) { return binary_tuple_parser::get_date_time(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_timestamp> : static_tuple_element_base<ignite_timestamp, 12> {
+    static tuple_size_t gauge(const ignite_timestamp &value) noexcept {
+        return binary_tuple_builder::gauge_timestamp(value);
+    }
+
+    static void store(std::byte *dest, const ignite_timestamp &value, tuple_size_t size) noexcept {
+        bytes::store<endian::LITTLE>(dest, value.get_epoch_second());
+        if (size == 12)
+            bytes::store<endian::LITTLE>(dest + 8, value.get_nano());
+    }
+
+    static ignite_timestamp load(bytes_view bytes) { return binary_tuple_parser::get_timestamp(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_period> : static_tuple_element_base<ignite_period, 12> {
+    static tuple_size_t gauge(const ignite_period &value) noexcept { return binary_tuple_builder::gauge_period(value); }
+
+    static void store(std::byte *dest, const ignite_period &value, tuple_size_t size) noexcept {
+        binary_tuple_builder::store_period(dest, value, size);
+    }
+
+    static ignite_period load(bytes_view bytes) { return binary_tuple_parser::get_period(bytes); }
+};
+
+template<>
+struct static_tuple_element<ignite_duration> : static_tuple_element_base<ignite_duration, 12> {
+    static tuple_size_t gauge(const ignite_duration &value) noexcept {
+        return binary_tuple_builder::gauge_duration(value);
+    }
+
+    static void store(std::byte *dest, const ignite_duration &value, tuple_size_t size) noexcept {
+        bytes::store<endian::LITTLE>(dest, value.get_seconds());
+        if (size == 12)
+            bytes::store<endian::LITTLE>(dest + 8, value.get_nano());
+    }
+
+    static ignite_duration load(bytes_view bytes) { return binary_tuple_parser::get_duration(bytes); }
+};
+
+template<>
+struct static_tuple_element<big_integer> : static_tuple_element_base<big_integer, 0> {
+    static tuple_size_t gauge(const big_integer &value) noexcept { return binary_tuple_builder::gauge_number(value); }
+
+    static void store(std::byte *dest, const big_integer &value, tuple_size_t /*size*/) noexcept {
+        value.store_bytes(dest);
+    }
+
+    static big_integer load(bytes_view bytes) { return binary_tuple_parser::get_number(bytes); }
+};
+
+template<>
+struct static_tuple_element<std::string> : static_tuple_element_base<std::string, 0> {
+    static tuple_size_t gauge(const std::string &value) noexcept { return tuple_size_t(value.size()); }
+
+    static void store(std::byte *dest, const std::string &value, tuple_size_t size) noexcept {
+        std::memcpy(dest, value.data(), size);
+    }
+
+    static std::string load(bytes_view bytes) { return {reinterpret_cast<const char *>(bytes.data()), bytes.size()}; }
+};
+
+template<>
+struct static_tuple_element<std::vector<std::byte>> : static_tuple_element_base<std::vector<std::byte>, 0> {
+    static tuple_size_t gauge(const std::vector<std::byte> &value) noexcept { return tuple_size_t(value.size()); }
+
+    static void store(std::byte *dest, const std::vector<std::byte> &value, tuple_size_t size) noexcept {
+        std::memcpy(dest, value.data(), size);
+    }
+
+    static std::vector<std::byte> load(bytes_view bytes) { return {bytes.begin(), bytes.end()}; }
+};
+
+/**
+ * @brief Nullable element.
+ *
+ * @tparam T Type of the non-null value.
+ */
+template<typename T>
+struct static_tuple_element<std::optional<T>> {
+    /** Type of the non-null value. */
+    using value_element = static_tuple_element<T>;
+
+    /** Nullability of the element. */
+    static constexpr bool NULLABLE = true;
+
+    /** Maximum size of the value, or zero for variable-length values. */
+    static constexpr tuple_size_t MAX_SIZE = value_element::MAX_SIZE;
+
+    static constexpr bool is_null(const std::optional<T> &value) noexcept { return !value.has_value(); }
+
+    static tuple_size_t gauge(const std::optional<T> &value) noexcept {
+        return value ? value_element::gauge(*value) : 0;
+    }
+
+    static void store(std::byte *dest, const std::optional<T> &value, tuple_size_t size) noexcept {
+        if (value)
+            value_element::store(dest, *value, size);
+    }
+
+    static std::optional<T> load(bytes_view bytes) { return value_element::load(bytes); }
+};
+
+} // namespace ignite::detail
@@ -17,6 +17,8 @@
 
 #include "binary_tuple_builder.h"
 #include "binary_tuple_parser.h"
+#include "static_binary_tuple_builder.h"
+#include "static_binary_tuple_parser.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -811,6 +813,262 @@ TEST(tuple, StringAfterNull) {
     EXPECT_EQ("Bob", get_value<std::string>(tp.get_next()));
 }
 
+TEST(tuple, InPlaceLayout) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 4;
+
+    auto fill = [](binary_tuple_builder &tb, auto &&do_layout) {
+        tb.start();
+        tb.claim_int32(101);
+        tb.claim(std::nullopt);
+        tb.claim_string("Bob");
+        tb.claim_int64(std::numeric_limits<std::int64_t>::max());
+
+        do_layout();
+
+        tb.append_int32(101);
+        tb.append(std::nullopt);
+        tb.append_string("Bob");
+        tb.append_int64(std::numeric_limits<std::int64_t>::max());
+    };
+
+    binary_tuple_builder tb(NUM_ELEMENTS);
+    fill(tb, [&tb] { tb.layout(); });
+    auto expected = tb.build();
+
+    // Garbage around and inside the target memory must not affect the result.
+    std::vector<std::byte> buffer(expected.size() + 2, std::byte{0xFF});
+    fill(tb, [&tb, &buffer] {
+        ASSERT_EQ(buffer.size() - 2, tb.get_tuple_size());
+        tb.layout(buffer.data() + 1);
+    });
+
+    EXPECT_EQ(std::byte{0xFF}, buffer.front());
+    EXPECT_EQ(std::byte{0xFF}, buffer.back());
+    EXPECT_EQ(expected, std::vector<std::byte>(buffer.begin() + 1, buffer.end() - 1));
+
+    binary_tuple_parser tp(NUM_ELEMENTS, bytes_view{buffer.data() + 1, expected.size()});
+
+    EXPECT_EQ(101, get_value<int32_t>(tp.get_next()));
+    EXPECT_FALSE(tp.get_next().has_value());
+    EXPECT_EQ("Bob", get_value<std::string>(tp.get_next()));
+    EXPECT_EQ(std::numeric_limits<std::int64_t>::max(), get_value<int64_t>(tp.get_next()));
+}
+
+TEST(tuple, SinglePass) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 5;
+
+    for (std::size_t str_size : {0, 3, 300, 70000}) {
+        std::string str(str_size, 'x');
+
+        binary_tuple_builder two_pass(NUM_ELEMENTS);
+        two_pass.start();
+        two_pass.claim_int32(101);
+        two_pass.claim(std::nullopt);
+        two_pass.claim_string(str);
+        two_pass.claim_double(0.5);
+        two_pass.claim_uuid(uuid(1, 2));
+        two_pass.layout();
+        two_pass.append_int32(101);
+        two_pass.append(std::nullopt);
+        two_pass.append_string(str);
+        two_pass.append_double(0.5);
+        two_pass.append_uuid(uuid(1, 2));
+        auto expected = two_pass.build();
+
+        binary_tuple_builder single_pass(NUM_ELEMENTS);
+        for (int i = 0; i < 2; ++i) {
+            single_pass.start_single_pass();
+            single_pass.append_int32(101);
+            single_pass.append(std::nullopt);
+            single_pass.append_string(str);
+            single_pass.append_double(0.5);
+            single_pass.append_uuid(uuid(1, 2));
+
+            ASSERT_EQ(expected.size(), single_pass.get_tuple_size());
+            EXPECT_EQ(expected, single_pass.build());
+
+            std::vector<std::byte> in_place(single_pass.get_tuple_size(), std::byte{0xFF});
+            single_pass.build(in_place.data());
+            EXPECT_EQ(expected, in_place);
+        }
+    }
+}
+
+TEST(tuple, SinglePassNoNulls) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 2;
+
+    binary_tuple_builder tb(NUM_ELEMENTS);
+    tb.start_single_pass();
+    tb.append_int64(42);
+    tb.append_string("Bob");
+
+    auto tuple = tb.build();
+    EXPECT_EQ(std::byte{0}, tuple[0] & binary_tuple_common::NULLMAP_FLAG);
+
+    binary_tuple_parser tp(NUM_ELEMENTS, tuple);
+    EXPECT_EQ(42, get_value<int64_t>(tp.get_next()));
+    EXPECT_EQ("Bob", get_value<std::string>(tp.get_next()));
+}
+
+TEST(tuple, RandomAccess) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 37;
+
+    // Value sizes are chosen to get offset table entries of 1, 2 and 4 bytes.
+    for (std::size_t str_size : {1, 100, 2000}) {
+        std::vector<std::optional<std::string>> values;
+        for (tuple_num_t i = 0; i < NUM_ELEMENTS; ++i) {
+            if (i % 5 == 3)
+                values.emplace_back(std::nullopt);
+            else if (i % 7 == 6)
+                values.emplace_back("");
+            else
+                values.emplace_back(std::string(str_size + i, char('a' + i % 26)));
+        }
+
+        binary_tuple_builder tb(NUM_ELEMENTS);
+        tb.start_single_pass();
+        for (const auto &value : values) {
+            if (value)
+                tb.append_string(*value);
+            else
+                tb.append(std::nullopt);
+        }
+        auto tuple = tb.build();
+
+        binary_tuple_parser tp(NUM_ELEMENTS, tuple);
+
+        for (tuple_num_t i = NUM_ELEMENTS - 1; i >= 0; --i) {
+            auto element = tp.get(i);
+            ASSERT_EQ(values[i].has_value(), element.has_value()) << "i=" << i;
+            EXPECT_EQ(values[i].has_value(), !tp.is_null(i)) << "i=" << i;
+            if (element) {
+                EXPECT_EQ(*values[i], get_value<std::string>(element)) << "i=" << i;
+            }
+        }
+
+        std::vector<tuple_size_t> ends(NUM_ELEMENTS);
+        tp.decode_offsets(ends.data());
+
+        auto value_area = tp.get_value_area();
+        tuple_size_t begin = 0;
+        for (tuple_num_t i = 0; i < NUM_ELEMENTS; ++i) {
+            ASSERT_LE(begin, ends[i]) << "i=" << i;
+            ASSERT_LE(ends[i], value_area.size()) << "i=" << i;
+
+            std::string str(reinterpret_cast<const char *>(value_area.data() + begin), ends[i] - begin);
+            EXPECT_EQ(values[i].value_or(""), str) << "i=" << i;
+
+            begin = ends[i];
+        }
+
+        // Random access does not affect sequential parsing.
+        for (tuple_num_t i = 0; i < NUM_ELEMENTS; ++i)
+            EXPECT_EQ(tp.get(i), tp.get_next()) << "i=" << i;
+    }
+}
+
+TEST(tuple, StaticBuilderMixed) { // NOLINT(cert-err58-cpp)
+    using builder_type = static_binary_tuple_builder<std::int64_t, std::optional<std::string>, double, ignite_timestamp>;
+    using parser_type = static_binary_tuple_parser<std::int64_t, std::optional<std::string>, double, ignite_timestamp>;
+
+    static_assert(builder_type::ELEMENT_COUNT == 4);
+    static_assert(builder_type::NULLABLE);
+    static_assert(!builder_type::FIXED_SIZE);
+    static_assert(builder_type::STATIC_ENTRY_SIZE == 0);
+
+    std::vector<std::tuple<std::int64_t, std::optional<std::string>, double, ignite_timestamp>> rows = {
+        {0, std::nullopt, 0.0, ignite_timestamp()},
+        {-1, ""s, 0.5, ignite_timestamp(1, 0)},
+        {1000, "abc"s, 0.1, ignite_timestamp(1700000000, 123)},
+        {100000, std::string(300, 'x'), -2.0, ignite_timestamp(-5, 999999999)},
+        {INT64_MIN, std::string(70000, 'y'), 1e300, ignite_timestamp(INT64_MAX, 1)},
+    };
+
+    builder_type builder;
+    for (const auto &[i64, str, dbl, ts] : rows) {
+        binary_tuple_builder dynamic(builder_type::ELEMENT_COUNT);
+        dynamic.start_single_pass();
+        dynamic.append_int64(i64);
+        if (str)
+            dynamic.append_string(*str);
+        else
+            dynamic.append(std::nullopt);
+        dynamic.append_double(dbl);
+        dynamic.append_timestamp(ts);
+        auto expected = dynamic.build();
+
+        ASSERT_EQ(expected.size(), builder.get_tuple_size(i64, str, dbl, ts));
+
+        std::vector<std::byte> in_place(expected.size(), std::byte{0xFF});
+        builder.build(in_place.data(), i64, str, dbl, ts);
+        EXPECT_EQ(expected, in_place);
+        EXPECT_EQ(expected, builder.build(i64, str, dbl, ts));
+
+        parser_type parser(expected);
+        EXPECT_EQ(expected.size(), parser.get_size());
+        EXPECT_EQ(i64, parser.get<0>());
+        EXPECT_EQ(str, parser.get<1>());
+        EXPECT_EQ(dbl, parser.get<2>());
+        EXPECT_EQ(ts, parser.get<3>());
+        EXPECT_EQ(std::make_tuple(i64, str, dbl, ts), parser.get_all());
+    }
+}
+
+TEST(tuple, StaticBuilderFixedSize) { // NOLINT(cert-err58-cpp)
+    using builder_type = static_binary_tuple_builder<bool, std::int8_t, std::int16_t, std::int32_t, float, uuid,
+        ignite_date, ignite_time, ignite_date_time, ignite_period, ignite_duration>;
+    using parser_type = static_binary_tuple_parser<bool, std::int8_t, std::int16_t, std::int32_t, float, uuid,
+        ignite_date, ignite_time, ignite_date_time, ignite_period, ignite_duration>;
+
+    static_assert(!builder_type::NULLABLE);
+    static_assert(builder_type::FIXED_SIZE);
+    static_assert(builder_type::MAX_VALUE_AREA_SIZE == 1 + 1 + 2 + 4 + 4 + 16 + 3 + 6 + 9 + 12 + 12);
+    static_assert(builder_type::STATIC_ENTRY_SIZE == 1);
+    static_assert(builder_type::MAX_TUPLE_SIZE == 1 + 11 + builder_type::MAX_VALUE_AREA_SIZE);
+
+    auto check = [](bool b, std::int8_t i8, std::int16_t i16, std::int32_t i32, float f, uuid u, ignite_date d,
+                     ignite_time t, ignite_date_time dt, ignite_period p, ignite_duration du) {
+        binary_tuple_builder dynamic(builder_type::ELEMENT_COUNT);
+        dynamic.start_single_pass();
+        dynamic.append_bool(b);
+        dynamic.append_int8(i8);
+        dynamic.append_int16(i16);
+        dynamic.append_int32(i32);
+        dynamic.append_float(f);
+        dynamic.append_uuid(u);
+        dynamic.append_date(d);
+        dynamic.append_time(t);
+        dynamic.append_date_time(dt);
+        dynamic.append_period(p);
+        dynamic.append_duration(du);
+        auto expected = dynamic.build();
+
+        builder_type builder;
+        std::array<std::byte, builder_type::MAX_TUPLE_SIZE> buffer{};
+        auto size = builder.get_tuple_size(b, i8, i16, i32, f, u, d, t, dt, p, du);
+        builder.build(buffer.data(), b, i8, i16, i32, f, u, d, t, dt, p, du);
+        EXPECT_EQ(expected, std::vector<std::byte>(buffer.begin(), buffer.begin() + size));
+
+        parser_type parser({buffer.data(), size});
+        EXPECT_EQ(std::make_tuple(b, i8, i16, i32, f, u, d, t, dt, p, du), parser.get_all());
+    };
+
+    check(false, 0, 0, 0, 0.0f, uuid(), ignite_date(), ignite_time(), ignite_date_time(), ignite_period(),
+        ignite_duration());
+    check(true, -7, 300, -70000, 1.5f, uuid(1, 2), ignite_date(2023, 12, 31), ignite_time(23, 59, 58, 1000),
+        ignite_date_time({1999, 1, 2}, {3, 4, 5, 6}), ignite_period(1, 2, 3), ignite_duration(60, 0));
+    check(true, INT8_MIN, INT16_MIN, INT32_MAX, -0.25f, uuid(-1, -1), ignite_date(-1, 1, 1),
+        ignite_time(1, 2, 3, 4000000), ignite_date_time({2000, 2, 29}, {12, 0, 0, 7000}),
+        ignite_period(1000, -1000, 0), ignite_duration(-1, 999));
+}
+
+TEST(tuple, StaticParserUnexpectedNull) { // NOLINT(cert-err58-cpp)
+    auto tuple = static_binary_tuple_builder<std::optional<std::int32_t>>().build(std::nullopt);
+
+    EXPECT_EQ(std::nullopt, static_binary_tuple_parser<std::optional<std::int32_t>>(tuple).get<0>());
+    EXPECT_THROW((void) static_binary_tuple_parser<std::int32_t>(tuple).get<0>(), std::out_of_range);
+}
+
 TEST(tuple, EmptyValueTupleAssembler) { // NOLINT(cert-err58-cpp)
     static constexpr tuple_num_t NUM_ELEMENTS = 1;
 
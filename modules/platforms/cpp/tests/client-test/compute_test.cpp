@@ -163,6 +163,15 @@ TEST_F(compute_test, execute_with_args) {
     EXPECT_EQ(result.value().get<std::string>(), "5.3_00000000-0000-0000-0000-000000000000_42_null");
 }
 
+TEST_F(compute_test, execute_with_typed_args) {
+    auto cluster_nodes = m_client.get_cluster_nodes();
+
+    auto result = m_client.get_compute().execute(cluster_nodes, CONCAT_JOB, 5.3, uuid(), "42", std::nullopt);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value().get<std::string>(), "5.3_00000000-0000-0000-0000-000000000000_42_null");
+}
+
 TEST_F(compute_test, job_error_propagates_to_client) {
     auto cluster_nodes = m_client.get_cluster_nodes();
 
@@ -264,6 +273,23 @@ TEST_F(compute_test, execute_colocated_throws_when_table_does_not_exist) {
         ignite_error);
 }
 
+TEST_F(compute_test, execute_colocated_after_table_recreate) {
+    auto sql = m_client.get_sql();
+    sql.execute(nullptr, {"DROP TABLE IF EXISTS COMPUTE_RECREATE"}, {});
+    sql.execute(nullptr, {"CREATE TABLE COMPUTE_RECREATE(KEY BIGINT PRIMARY KEY, VAL VARCHAR)"}, {});
+
+    auto res1 = m_client.get_compute().execute_colocated("compute_recreate", get_tuple(42), ECHO_JOB, {"a", "a"});
+    EXPECT_EQ("a", res1.value().get<std::string>());
+
+    sql.execute(nullptr, {"DROP TABLE COMPUTE_RECREATE"}, {});
+    sql.execute(nullptr, {"CREATE TABLE COMPUTE_RECREATE(KEY BIGINT PRIMARY KEY, VAL VARCHAR)"}, {});
+
+    auto res2 = m_client.get_compute().execute_colocated("compute_recreate", get_tuple(42), ECHO_JOB, {"b", "b"});
+    EXPECT_EQ("b", res2.value().get<std::string>());
+
+    sql.execute(nullptr, {"DROP TABLE COMPUTE_RECREATE"}, {});
+}
+
 TEST_F(compute_test, execute_colocated_throws_when_key_column_is_missing) {
     EXPECT_THROW(
         {
@@ -0,0 +1,180 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ */
+class data_streamer_test : public ignite_runner_suite {
+protected:
+    void SetUp() override {
+        clear_table1();
+
+        ignite_client_configuration cfg{get_node_addrs()};
+        cfg.set_logger(get_logger());
+
+        m_client = ignite_client::start(cfg, std::chrono::seconds(30));
+        auto table = m_client.get_tables().get_table(TABLE_1);
+
+        tuple_view = table->get_record_binary_view();
+        kv_view = table->get_key_value_binary_view();
+    }
+
+    void TearDown() override { clear_table1(); }
+
+    /** Ignite client. */
+    ignite_client m_client;
+
+    /** Record binary view. */
+    record_view<ignite_tuple> tuple_view;
+
+    /** Key-Value binary view. */
+    key_value_view<ignite_tuple, ignite_tuple> kv_view;
+};
+
+TEST_F(data_streamer_test, streamed_records_are_visible_after_flush) {
+    data_streamer_options options;
+    options.page_size(7);
+
+    auto streamer = tuple_view.get_streamer(options);
+    for (int i = 0; i < 100; ++i)
+        streamer.add(get_tuple(i, "s_" + std::to_string(i)));
+
+    streamer.flush();
+
+    auto progress = streamer.progress();
+    EXPECT_EQ(100, progress.rows_added);
+    EXPECT_EQ(100, progress.rows_streamed);
+    EXPECT_EQ(0, progress.rows_failed);
+    EXPECT_EQ(0, progress.rows_pending());
+    EXPECT_EQ(15, progress.batches_streamed);
+
+    for (int i = 0; i < 100; ++i) {
+        auto res = tuple_view.get(nullptr, get_tuple(i));
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("s_" + std::to_string(i), res->get<std::string>("val"));
+    }
+
+    streamer.close();
+}
+
+TEST_F(data_streamer_test, streamed_pairs_are_visible_after_close) {
+    auto streamer = kv_view.get_streamer();
+    for (int i = 0; i < 10; ++i)
+        streamer.add(get_tuple(i), get_tuple("s_" + std::to_string(i)));
+
+    streamer.add(get_tuple(10, "s_10"));
+    streamer.close();
+
+    for (int i = 0; i <= 10; ++i) {
+        auto res = kv_view.get(nullptr, get_tuple(i));
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("s_" + std::to_string(i), res->get<std::string>("val"));
+    }
+}
+
+TEST_F(data_streamer_test, rows_can_be_added_from_many_threads) {
+    static constexpr int THREADS = 4;
+    static constexpr int ROWS_PER_THREAD = 500;
+
+    data_streamer_options options;
+    options.page_size(50);
+    options.max_pending_rows(200);
+
+    std::atomic_int64_t progress_calls{0};
+    options.progress_handler([&progress_calls](const data_streamer_progress &) { ++progress_calls; });
+
+    auto streamer = tuple_view.get_streamer(options);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&streamer, t] {
+            for (int i = 0; i < ROWS_PER_THREAD; ++i)
+                streamer.add(get_tuple(t * ROWS_PER_THREAD + i, "s"));
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    streamer.close();
+
+    auto progress = streamer.progress();
+    EXPECT_EQ(THREADS * ROWS_PER_THREAD, progress.rows_streamed);
+    EXPECT_EQ(progress.batches_streamed, progress_calls.load());
+
+    auto count = m_client.get_sql().execute(nullptr, {"SELECT COUNT(*) FROM " + std::string(TABLE_1)}, {});
+    EXPECT_EQ(THREADS * ROWS_PER_THREAD, count.current_page().front().get(0).get<std::int64_t>());
+}
+
+TEST_F(data_streamer_test, old_batch_is_sent_automatically) {
+    data_streamer_options options;
+    options.auto_flush_interval(std::chrono::milliseconds(100));
+
+    auto streamer = tuple_view.get_streamer(options);
+    streamer.add(get_tuple(1, "foo"));
+
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+
+    EXPECT_EQ(1, streamer.progress().rows_streamed);
+    auto res = tuple_view.get(nullptr, get_tuple(1));
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ("foo", res->get<std::string>("val"));
+}
+
+TEST_F(data_streamer_test, add_after_close_throws) {
+    auto streamer = tuple_view.get_streamer();
+    streamer.close();
+
+    EXPECT_THROW(
+        {
+            try {
+                streamer.add(get_tuple(1, "foo"));
+            } catch (const ignite_error &e) {
+                EXPECT_STREQ("Data streamer is closed", e.what());
+                throw;
+            }
+        },
+        ignite_error);
+}
+
+TEST_F(data_streamer_test, failed_batch_is_reported) {
+    data_streamer_options options;
+    options.retry_limit(1);
+
+    auto streamer = tuple_view.get_streamer(options);
+    streamer.add(ignite_tuple{{"key", std::string("not a number")}});
+
+    EXPECT_THROW(streamer.flush(), ignite_error);
+
+    auto progress = streamer.progress();
+    EXPECT_EQ(1, progress.rows_failed);
+    EXPECT_EQ(1, progress.batches_retried);
+    EXPECT_THROW(streamer.add(get_tuple(1, "foo")), ignite_error);
+}
@@ -21,9 +21,12 @@
 #include <ignite/client/ignite_client.h>
 #include <ignite/client/ignite_client_configuration.h>
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <future>
 
 using namespace ignite;
 
@@ -43,4 +46,251 @@ TEST_F(client_test, get_configuration) {
 
     EXPECT_EQ(cfg.get_endpoints(), cfg2.get_endpoints());
     EXPECT_EQ(cfg.get_connection_limit(), cfg2.get_connection_limit());
-}
\ No newline at end of file
+}
+
+TEST_F(client_test, hedged_reads) {
+    hedged_read_options hedging;
+    hedging.enabled(true);
+    hedging.delay(std::chrono::milliseconds(1));
+    hedging.max_extra_load(1.0);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_hedged_reads(hedging);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto tuple_view = client.get_tables().get_table(TABLE_1)->get_record_binary_view();
+
+    for (std::int64_t i = 0; i < 10; ++i)
+        tuple_view.upsert(nullptr, get_tuple(i, "s_" + std::to_string(i)));
+
+    constexpr std::int64_t reads_num = 100;
+    for (std::int64_t i = 0; i < reads_num; ++i) {
+        auto key = i % 10;
+        auto res = tuple_view.get(nullptr, get_tuple(key));
+
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("s_" + std::to_string(key), res->get<std::string>(VAL_COLUMN));
+    }
+
+    auto stats = client.get_hedged_read_statistics();
+    EXPECT_EQ(reads_num, stats.reads);
+    EXPECT_LE(stats.hedges_won, stats.hedges_issued);
+    EXPECT_LE(stats.hedges_issued, stats.reads);
+
+    clear_table1();
+}
+
+TEST_F(client_test, hedged_reads_disabled_by_default) {
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto tuple_view = client.get_tables().get_table(TABLE_1)->get_record_binary_view();
+
+    auto res = tuple_view.get(nullptr, get_tuple(1));
+    EXPECT_FALSE(res.has_value());
+
+    auto stats = client.get_hedged_read_statistics();
+    EXPECT_EQ(0, stats.reads);
+    EXPECT_EQ(0, stats.hedges_issued);
+}
+
+TEST_F(client_test, hedged_reads_invalid_options) {
+    hedged_read_options hedging;
+    hedging.enabled(true);
+    hedging.max_extra_load(2.0);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_hedged_reads(hedging);
+
+    EXPECT_THROW(
+        {
+            try {
+                (void) ignite_client::start(cfg, std::chrono::seconds(30));
+            } catch (const ignite_error &e) {
+                EXPECT_THAT(e.what_str(), testing::HasSubstr("Hedging max extra load is not in the (0, 1] range"));
+                throw;
+            }
+        },
+        ignite_error);
+}
+
+TEST_F(client_test, concurrency_limit_queues_requests) {
+    concurrency_limit_options limit;
+    limit.enabled(true);
+    limit.initial_limit(2);
+    limit.max_limit(4);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_concurrency_limit(limit);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto tuple_view = client.get_tables().get_table(TABLE_1)->get_record_binary_view();
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+
+    constexpr std::int32_t reads_num = 100;
+    std::atomic_int32_t remaining{reads_num};
+    std::atomic_int32_t errors{0};
+    std::promise<void> all_done;
+    for (std::int32_t i = 0; i < reads_num; ++i) {
+        tuple_view.get_async(nullptr, get_tuple(1), [&](ignite_result<std::optional<ignite_tuple>> &&res) {
+            if (res.has_error() || !res.value().has_value())
+                ++errors;
+
+            if (--remaining == 0)
+                all_done.set_value();
+        });
+    }
+
+    all_done.get_future().get();
+    EXPECT_EQ(0, errors.load());
+
+    auto stats = client.get_concurrency_limit_statistics();
+    EXPECT_FALSE(stats.empty());
+    for (const auto &node_stats : stats) {
+        EXPECT_FALSE(node_stats.node_name.empty());
+        EXPECT_GE(node_stats.limit, limit.min_limit());
+        EXPECT_LE(node_stats.limit, limit.max_limit());
+        EXPECT_EQ(0, node_stats.in_flight);
+        EXPECT_EQ(0, node_stats.queued);
+        EXPECT_EQ(0, node_stats.rejected);
+    }
+
+    clear_table1();
+}
+
+TEST_F(client_test, concurrency_limit_fails_fast_without_queue) {
+    concurrency_limit_options limit;
+    limit.enabled(true);
+    limit.initial_limit(1);
+    limit.max_limit(1);
+    limit.max_queue_size(0);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_concurrency_limit(limit);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto tuple_view = client.get_tables().get_table(TABLE_1)->get_record_binary_view();
+
+    // Load the schema, so that only the reads below compete for the limit.
+    (void) tuple_view.get(nullptr, get_tuple(1));
+
+    // Rejected reads fail right away, without their callbacks being called.
+    constexpr std::int32_t reads_num = 50;
+    std::atomic_int32_t remaining{reads_num};
+    std::atomic_int32_t rejected{0};
+    std::promise<void> all_done;
+    for (std::int32_t i = 0; i < reads_num; ++i) {
+        try {
+            tuple_view.get_async(nullptr, get_tuple(1), [&](ignite_result<std::optional<ignite_tuple>> &&) {
+                if (--remaining == 0)
+                    all_done.set_value();
+            });
+        } catch (const ignite_error &e) {
+            EXPECT_THAT(e.what_str(), testing::HasSubstr("Too many requests in flight"));
+            ++rejected;
+
+            if (--remaining == 0)
+                all_done.set_value();
+        }
+    }
+
+    all_done.get_future().get();
+    EXPECT_GT(rejected.load(), 0);
+
+    std::int64_t rejected_total = 0;
+    for (const auto &node_stats : client.get_concurrency_limit_statistics()) {
+        EXPECT_EQ(1, node_stats.limit);
+        rejected_total += node_stats.rejected;
+    }
+    EXPECT_EQ(rejected.load(), rejected_total);
+}
+
+TEST_F(client_test, deduplicated_reads_rejected_by_concurrency_limit_complete) {
+    concurrency_limit_options limit;
+    limit.enabled(true);
+    limit.initial_limit(1);
+    limit.max_limit(1);
+    limit.max_queue_size(0);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_concurrency_limit(limit);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    auto table = client.get_tables().get_table(TABLE_1);
+    table->enable_read_deduplication();
+    auto tuple_view = table->get_record_binary_view();
+
+    // Load the schema, so that only the reads below compete for the limit.
+    (void) tuple_view.get(nullptr, get_tuple(1));
+
+    // Reads which are rejected fail their own and the attached callbacks instead of leaving them waiting.
+    constexpr std::int32_t reads_num = 50;
+    std::atomic_int32_t remaining{reads_num};
+    std::promise<void> all_done;
+    for (std::int32_t i = 0; i < reads_num; ++i) {
+        tuple_view.get_async(nullptr, get_tuple(i % 3), [&](ignite_result<std::optional<ignite_tuple>> &&) {
+            if (--remaining == 0)
+                all_done.set_value();
+        });
+    }
+
+    auto status = all_done.get_future().wait_for(std::chrono::seconds(30));
+    EXPECT_EQ(std::future_status::ready, status);
+
+    EXPECT_NO_THROW((void) tuple_view.get(nullptr, get_tuple(2)));
+}
+
+TEST_F(client_test, concurrency_limit_does_not_apply_to_sql) {
+    concurrency_limit_options limit;
+    limit.enabled(true);
+    limit.initial_limit(1);
+    limit.max_limit(1);
+    limit.max_queue_size(0);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_concurrency_limit(limit);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    constexpr std::int32_t queries_num = 10;
+    std::vector<std::promise<result_set>> promises(queries_num);
+    for (auto &promise : promises) {
+        client.get_sql().execute_async(
+            nullptr, {"SELECT 1"}, {}, [&promise](auto res) { result_set_promise(promise, std::move(res)); });
+    }
+
+    for (auto &promise : promises)
+        EXPECT_NO_THROW((void) promise.get_future().get());
+
+    for (const auto &node_stats : client.get_concurrency_limit_statistics())
+        EXPECT_EQ(0, node_stats.rejected);
+}
+
+TEST_F(client_test, concurrency_limit_invalid_options) {
+    concurrency_limit_options limit;
+    limit.enabled(true);
+    limit.min_limit(10);
+    limit.max_limit(5);
+
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_concurrency_limit(limit);
+
+    EXPECT_THROW(
+        {
+            try {
+                (void) ignite_client::start(cfg, std::chrono::seconds(30));
+            } catch (const ignite_error &e) {
+                EXPECT_THAT(e.what_str(), testing::HasSubstr("Maximum concurrency limit is less than the minimum one"));
+                throw;
+            }
+        },
+        ignite_error);
+}
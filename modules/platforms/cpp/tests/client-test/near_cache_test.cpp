@@ -0,0 +1,218 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace ignite;
+
+/**
+ * Test suite.
+ */
+class near_cache_test : public ignite_runner_suite {
+protected:
+    void SetUp() override {
+        clear_table1();
+
+        ignite_client_configuration cfg{get_node_addrs()};
+        cfg.set_logger(get_logger());
+
+        m_client = ignite_client::start(cfg, std::chrono::seconds(30));
+        m_table = std::make_unique<table>(std::move(*m_client.get_tables().get_table(TABLE_1)));
+
+        tuple_view = m_table->get_record_binary_view();
+        kv_view = m_table->get_key_value_binary_view();
+    }
+
+    void TearDown() override { clear_table1(); }
+
+    /** Ignite client. */
+    ignite_client m_client;
+
+    /** Table. */
+    std::unique_ptr<table> m_table;
+
+    /** Record binary view. */
+    record_view<ignite_tuple> tuple_view;
+
+    /** Key-Value binary view. */
+    key_value_view<ignite_tuple, ignite_tuple> kv_view;
+};
+
+TEST_F(near_cache_test, repeated_get_is_served_from_cache) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    m_table->enable_near_cache();
+
+    for (int i = 0; i < 3; ++i) {
+        auto res = tuple_view.get(nullptr, get_tuple(1));
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("foo", res->get<std::string>("val"));
+    }
+
+    EXPECT_TRUE(kv_view.contains(nullptr, get_tuple(1)));
+
+    auto stats = m_table->get_near_cache_statistics();
+    EXPECT_EQ(1, stats.misses);
+    EXPECT_EQ(3, stats.hits);
+    EXPECT_EQ(1, stats.entry_count);
+    EXPECT_GT(stats.size_bytes, 0);
+}
+
+TEST_F(near_cache_test, own_write_invalidates_entry) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    m_table->enable_near_cache();
+
+    EXPECT_EQ("foo", tuple_view.get(nullptr, get_tuple(1))->get<std::string>("val"));
+
+    kv_view.put(nullptr, get_tuple(1), get_tuple("bar"));
+    EXPECT_EQ("bar", tuple_view.get(nullptr, get_tuple(1))->get<std::string>("val"));
+
+    tuple_view.remove(nullptr, get_tuple(1));
+    EXPECT_FALSE(tuple_view.get(nullptr, get_tuple(1)).has_value());
+
+    EXPECT_EQ(2, m_table->get_near_cache_statistics().invalidations);
+}
+
+TEST_F(near_cache_test, get_all_requests_only_missing_keys) {
+    for (int i = 0; i < 4; ++i)
+        tuple_view.upsert(nullptr, get_tuple(i, "s_" + std::to_string(i)));
+
+    m_table->enable_near_cache();
+    (void) tuple_view.get(nullptr, get_tuple(0));
+    (void) tuple_view.get(nullptr, get_tuple(2));
+
+    auto res = tuple_view.get_all(nullptr, {get_tuple(0), get_tuple(1), get_tuple(2), get_tuple(3), get_tuple(4)});
+
+    // Same as without the near cache, only the existing records are returned.
+    ASSERT_EQ(4, res.size());
+    for (const auto &record : res) {
+        ASSERT_TRUE(record.has_value());
+        auto key = record->get<std::int64_t>("key");
+        EXPECT_EQ("s_" + std::to_string(key), record->get<std::string>("val"));
+    }
+
+    auto stats = m_table->get_near_cache_statistics();
+    EXPECT_EQ(2, stats.hits);
+    EXPECT_EQ(5, stats.misses);
+    EXPECT_EQ(4, stats.entry_count);
+}
+
+TEST_F(near_cache_test, get_all_caches_records_under_their_keys) {
+    for (int i = 0; i < 10; i += 2)
+        tuple_view.upsert(nullptr, get_tuple(i, "s_" + std::to_string(i)));
+
+    m_table->enable_near_cache();
+
+    std::vector<ignite_tuple> keys;
+    for (int i = 0; i < 10; ++i)
+        keys.push_back(get_tuple(i));
+
+    auto res = tuple_view.get_all(nullptr, keys);
+    EXPECT_EQ(5, res.size());
+
+    // The records are served from the near cache now, every one of them under its own key.
+    for (int i = 0; i < 10; ++i) {
+        auto record = tuple_view.get(nullptr, get_tuple(i));
+        if (i % 2) {
+            EXPECT_FALSE(record.has_value());
+        } else {
+            ASSERT_TRUE(record.has_value());
+            EXPECT_EQ(i, record->get<std::int64_t>("key"));
+            EXPECT_EQ("s_" + std::to_string(i), record->get<std::string>("val"));
+        }
+    }
+    EXPECT_EQ(5, m_table->get_near_cache_statistics().hits);
+}
+
+TEST_F(near_cache_test, entry_expires) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+
+    near_cache_options options;
+    options.ttl(std::chrono::milliseconds(100));
+    m_table->enable_near_cache(options);
+
+    (void) tuple_view.get(nullptr, get_tuple(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    (void) tuple_view.get(nullptr, get_tuple(1));
+
+    auto stats = m_table->get_near_cache_statistics();
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(1, stats.expirations);
+}
+
+TEST_F(near_cache_test, least_recently_used_entry_is_evicted) {
+    for (int i = 0; i < 3; ++i)
+        tuple_view.upsert(nullptr, get_tuple(i, "foo"));
+
+    m_table->enable_near_cache();
+    (void) tuple_view.get(nullptr, get_tuple(0));
+    auto entry_size = m_table->get_near_cache_statistics().size_bytes;
+
+    near_cache_options options;
+    options.max_size_bytes(entry_size * 2);
+    m_table->enable_near_cache(options);
+
+    (void) tuple_view.get(nullptr, get_tuple(0));
+    (void) tuple_view.get(nullptr, get_tuple(1));
+    (void) tuple_view.get(nullptr, get_tuple(0));
+    (void) tuple_view.get(nullptr, get_tuple(2));
+
+    auto stats = m_table->get_near_cache_statistics();
+    EXPECT_EQ(1, stats.evictions);
+    EXPECT_EQ(2, stats.entry_count);
+
+    EXPECT_TRUE(tuple_view.get(nullptr, get_tuple(0)).has_value());
+    EXPECT_EQ(2, m_table->get_near_cache_statistics().hits);
+}
+
+TEST_F(near_cache_test, transactional_reads_bypass_cache) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    m_table->enable_near_cache();
+    (void) tuple_view.get(nullptr, get_tuple(1));
+
+    auto tx = m_client.get_transactions().begin();
+    tuple_view.upsert(&tx, get_tuple(1, "bar"));
+    EXPECT_EQ("bar", tuple_view.get(&tx, get_tuple(1))->get<std::string>("val"));
+    tx.rollback();
+
+    EXPECT_EQ("foo", tuple_view.get(nullptr, get_tuple(1))->get<std::string>("val"));
+    EXPECT_EQ(0, m_table->get_near_cache_statistics().hits);
+}
+
+TEST_F(near_cache_test, transaction_finish_invalidates_written_keys) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    m_table->enable_near_cache();
+
+    transaction_options options;
+    options.write_buffer_limit(10);
+
+    auto tx = m_client.get_transactions().begin(options);
+    tuple_view.upsert(&tx, get_tuple(1, "bar"));
+
+    // The row committed before the transaction is cached while the transaction is in progress.
+    EXPECT_EQ("foo", tuple_view.get(nullptr, get_tuple(1))->get<std::string>("val"));
+    tx.commit();
+
+    EXPECT_EQ("bar", tuple_view.get(nullptr, get_tuple(1))->get<std::string>("val"));
+}
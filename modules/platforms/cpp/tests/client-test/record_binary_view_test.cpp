@@ -23,7 +23,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 using namespace ignite;
 
@@ -71,6 +73,50 @@ TEST_F(record_binary_view_test, upsert_get) {
     EXPECT_EQ("foo", res_tuple->get<std::string>("val"));
 }
 
+TEST_F(record_binary_view_test, get_result_can_be_modified) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    auto res_tuple = tuple_view.get(nullptr, get_tuple(1));
+
+    ASSERT_TRUE(res_tuple.has_value());
+    EXPECT_EQ("foo", res_tuple->get<std::string>("val"));
+
+    res_tuple->set("val", std::string("bar"));
+    res_tuple->set("extra", std::int32_t(42));
+
+    EXPECT_EQ(3, res_tuple->column_count());
+    EXPECT_EQ(1L, res_tuple->get<int64_t>("key"));
+    EXPECT_EQ("bar", res_tuple->get<std::string>("val"));
+    EXPECT_EQ(42, res_tuple->get<std::int32_t>("extra"));
+
+    auto copy = *tuple_view.get(nullptr, get_tuple(1));
+    EXPECT_EQ("foo", copy.get<std::string>(1));
+    EXPECT_EQ("VAL", copy.column_name(1));
+    EXPECT_EQ(1, copy.column_ordinal("val"));
+    EXPECT_EQ(-1, copy.column_ordinal("extra"));
+}
+
+TEST_F(record_binary_view_test, get_result_can_be_read_concurrently) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    const auto res_tuple = *tuple_view.get(nullptr, get_tuple(1));
+
+    std::atomic_int32_t mismatches{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&res_tuple, &mismatches] {
+            for (int j = 0; j < 100; ++j) {
+                auto copy = res_tuple;
+                if (res_tuple.get<std::string>("val") != "foo" || copy.get<int64_t>("key") != 1)
+                    ++mismatches;
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(0, mismatches.load());
+}
+
 TEST_F(record_binary_view_test, upsert_get_async) {
     auto key_tuple = get_tuple(1);
     auto val_tuple = get_tuple(1, "foo");
@@ -113,6 +159,32 @@ TEST_F(record_binary_view_test, upsert_overrides_value) {
     EXPECT_EQ("bar", res_tuple->get<std::string>("val"));
 }
 
+TEST_F(record_binary_view_test, upsert_reuses_plan_for_same_shape) {
+    for (std::int64_t i = 1; i <= 10; ++i)
+        tuple_view.upsert(nullptr, {{"key", i}, {"val", "foo" + std::to_string(i)}});
+
+    // Same shape written with differently spelled names and from a tuple read from the server.
+    tuple_view.upsert(nullptr, {{"KEY", std::int64_t(11)}, {"\"VAL\"", std::string("foo11")}});
+    tuple_view.upsert(nullptr, *tuple_view.get(nullptr, get_tuple(1)));
+
+    // Same columns in a different order must not use the cached plan.
+    tuple_view.upsert(nullptr, {{"val", std::string("bar")}, {"key", std::int64_t(12)}});
+
+    for (std::int64_t i = 1; i <= 11; ++i) {
+        auto res_tuple = tuple_view.get(nullptr, get_tuple(i));
+
+        ASSERT_TRUE(res_tuple.has_value());
+        EXPECT_EQ(i, res_tuple->get<int64_t>("key"));
+        EXPECT_EQ("foo" + std::to_string(i), res_tuple->get<std::string>("val"));
+    }
+
+    auto res_tuple = tuple_view.get(nullptr, get_tuple(12));
+
+    ASSERT_TRUE(res_tuple.has_value());
+    EXPECT_EQ(12L, res_tuple->get<int64_t>("key"));
+    EXPECT_EQ("bar", res_tuple->get<std::string>("val"));
+}
+
 TEST_F(record_binary_view_test, upsert_empty_tuple_throws) {
     EXPECT_THROW(
         {
@@ -982,3 +1054,130 @@ TEST_F(record_binary_view_test, types_test) {
         }
     }
 }
+
+TEST_F(record_binary_view_test, coalesced_gets_from_many_threads) {
+    static constexpr int THREADS = 8;
+    static constexpr int GETS_PER_THREAD = 50;
+
+    for (int i = 0; i < 10; ++i)
+        tuple_view.upsert(nullptr, get_tuple(i, "s_" + std::to_string(i)));
+
+    auto table = m_client.get_tables().get_table(TABLE_1);
+    read_coalescing_options options;
+    options.max_batch_size(16);
+    options.max_batches_in_flight(1);
+    table->enable_read_coalescing(options);
+    auto kv_view = table->get_key_value_binary_view();
+
+    std::atomic_int failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([this, &kv_view, &failures, t] {
+            for (int i = 0; i < GETS_PER_THREAD; ++i) {
+                auto id = (t + i) % 12;
+                auto res = tuple_view.get(nullptr, get_tuple(id));
+                bool ok = id < 10 ? res.has_value() && res->get<std::string>("val") == "s_" + std::to_string(id)
+                                  : !res.has_value();
+                ok = ok && kv_view.contains(nullptr, get_tuple(id)) == (id < 10);
+                if (!ok)
+                    ++failures;
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(0, failures.load());
+
+    table->disable_read_coalescing();
+}
+
+TEST_F(record_binary_view_test, coalesced_get_with_bad_key_fails_only_its_caller) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+    tuple_view.upsert(nullptr, get_tuple(2, "bar"));
+
+    auto table = m_client.get_tables().get_table(TABLE_1);
+    read_coalescing_options options;
+    options.max_batch_size(16);
+    options.max_batches_in_flight(1);
+    table->enable_read_coalescing(options);
+
+    std::promise<std::optional<ignite_tuple>> first;
+    std::promise<std::optional<ignite_tuple>> bad;
+    std::promise<std::optional<ignite_tuple>> throwing;
+    std::promise<std::optional<ignite_tuple>> last;
+
+    tuple_view.get_async(nullptr, get_tuple(1), [&](auto res) { result_set_promise(first, std::move(res)); });
+    ignite_tuple bad_key{{KEY_COLUMN, std::string("not a number")}};
+    tuple_view.get_async(nullptr, bad_key, [&](auto res) { result_set_promise(bad, std::move(res)); });
+    tuple_view.get_async(nullptr, get_tuple(2), [&](auto res) {
+        result_set_promise(throwing, std::move(res));
+        throw ignite_error("Callback failure");
+    });
+    tuple_view.get_async(nullptr, get_tuple(3), [&](auto res) { result_set_promise(last, std::move(res)); });
+
+    auto first_res = first.get_future().get();
+    ASSERT_TRUE(first_res.has_value());
+    EXPECT_EQ("foo", first_res->get<std::string>("val"));
+
+    EXPECT_THROW((void) bad.get_future().get(), ignite_error);
+
+    auto throwing_res = throwing.get_future().get();
+    ASSERT_TRUE(throwing_res.has_value());
+    EXPECT_EQ("bar", throwing_res->get<std::string>("val"));
+
+    EXPECT_FALSE(last.get_future().get().has_value());
+
+    table->disable_read_coalescing();
+}
+
+TEST_F(record_binary_view_test, identical_gets_in_flight_are_deduplicated) {
+    static constexpr int GETS = 20;
+
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+
+    auto table = m_client.get_tables().get_table(TABLE_1);
+    table->enable_read_deduplication();
+
+    std::vector<std::promise<std::optional<ignite_tuple>>> promises(GETS);
+    for (auto &promise : promises) {
+        tuple_view.get_async(
+            nullptr, get_tuple(1), [&promise](auto res) { result_set_promise(promise, std::move(res)); });
+    }
+
+    for (auto &promise : promises) {
+        auto res = promise.get_future().get();
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ("foo", res->get<std::string>("val"));
+    }
+
+    // All the calls are made before the first response can arrive.
+    EXPECT_GT(table->get_deduplicated_read_count(), 0);
+
+    table->disable_read_deduplication();
+}
+
+TEST_F(record_binary_view_test, deduplicated_get_after_write_sees_the_write) {
+    tuple_view.upsert(nullptr, get_tuple(1, "foo"));
+
+    auto table = m_client.get_tables().get_table(TABLE_1);
+    table->enable_read_deduplication();
+
+    // The first read may still be in flight when the second one is issued, but it must not be shared across the write.
+    std::promise<std::optional<ignite_tuple>> before;
+    tuple_view.get_async(nullptr, get_tuple(1), [&](auto res) { result_set_promise(before, std::move(res)); });
+
+    tuple_view.upsert(nullptr, get_tuple(1, "bar"));
+
+    std::promise<std::optional<ignite_tuple>> after;
+    tuple_view.get_async(nullptr, get_tuple(1), [&](auto res) { result_set_promise(after, std::move(res)); });
+
+    auto after_res = after.get_future().get();
+    ASSERT_TRUE(after_res.has_value());
+    EXPECT_EQ("bar", after_res->get<std::string>("val"));
+
+    ASSERT_TRUE(before.get_future().get().has_value());
+
+    table->disable_read_deduplication();
+}
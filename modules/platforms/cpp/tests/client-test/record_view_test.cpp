@@ -22,6 +22,7 @@
 
 #include "ignite/client/ignite_client.h"
 #include "ignite/client/ignite_client_configuration.h"
+#include "ignite/client/struct_mapping.h"
 
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
@@ -63,6 +64,16 @@ struct wrong_mapping_value {
     std::string val;
 };
 
+/**
+ * Test table type with a struct mapping (@see ignite_runner_suite::TABLE_1).
+ */
+struct mapped_type {
+    std::int64_t id{0};
+    std::optional<std::string> val;
+};
+
+IGNITE_MAP_STRUCT(mapped_type, ignite::field("key", &mapped_type::id), IGNITE_FIELD(mapped_type, val))
+
 namespace ignite {
 
 template<>
@@ -994,3 +1005,29 @@ TEST_F(record_view_test, types_test) {
     EXPECT_EQ(ignite_timestamp(3875238472, 248700000), res->m_timestamp2);
 }
 
+TEST_F(record_view_test, mapped_struct_upsert_get) {
+    auto table = m_client.get_tables().get_table(TABLE_1);
+    auto mapped_view = table->get_record_view<mapped_type>();
+
+    mapped_view.upsert(nullptr, mapped_type{1, "foo"});
+    mapped_view.upsert_all(nullptr, {mapped_type{2, "bar"}, mapped_type{3, std::nullopt}});
+
+    auto res = mapped_view.get(nullptr, mapped_type{1, std::nullopt});
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(1, res->id);
+    EXPECT_EQ("foo", res->val);
+
+    auto all = mapped_view.get_all(nullptr, {mapped_type{2, {}}, mapped_type{3, {}}, mapped_type{4, {}}});
+    ASSERT_EQ(3, all.size());
+    ASSERT_TRUE(all[0].has_value());
+    EXPECT_EQ(2, all[0]->id);
+    EXPECT_EQ("bar", all[0]->val);
+    ASSERT_TRUE(all[1].has_value());
+    EXPECT_EQ(3, all[1]->id);
+    EXPECT_FALSE(all[1]->val.has_value());
+    EXPECT_FALSE(all[2].has_value());
+
+    auto typed = view.get(nullptr, test_type{2});
+    ASSERT_TRUE(typed.has_value());
+    EXPECT_EQ("bar", typed->val);
+}
@@ -147,6 +147,57 @@ TEST_F(sql_test, sql_table_select) {
     EXPECT_EQ(0, result_set.current_page().size());
 }
 
+TEST_F(sql_test, sql_table_select_string_view) {
+    auto result_set = m_client.get_sql().execute(nullptr, {"select id, val from TEST order by id"}, {});
+    auto page = result_set.current_page();
+
+    ASSERT_EQ(10, page.size());
+    for (std::int32_t i = 0; i < std::int32_t(page.size()); ++i) {
+        auto &row = page[i];
+
+        EXPECT_EQ("s-" + std::to_string(i), row.get_string_view(1));
+        EXPECT_EQ("s-" + std::to_string(i), row.get_string_view("val"));
+        EXPECT_THROW((void) row.get_string_view(0), ignite_error);
+        EXPECT_THROW((void) row.get_bytes_view("val"), ignite_error);
+    }
+}
+
+TEST_F(sql_test, sql_table_select_arrow) {
+    auto result_set = m_client.get_sql().execute(nullptr, {"select id, val from TEST order by id"}, {});
+
+    ArrowSchema schema{};
+    ArrowArray array{};
+    result_set.current_page_arrow(&schema, &array);
+
+    EXPECT_STREQ("+s", schema.format);
+    ASSERT_EQ(2, schema.n_children);
+    EXPECT_STREQ("ID", schema.children[0]->name);
+    EXPECT_STREQ("i", schema.children[0]->format);
+    EXPECT_STREQ("VAL", schema.children[1]->name);
+    EXPECT_STREQ("u", schema.children[1]->format);
+
+    ASSERT_EQ(10, array.length);
+    ASSERT_EQ(2, array.n_children);
+
+    auto ids = static_cast<const std::int32_t *>(array.children[0]->buffers[1]);
+    auto offsets = static_cast<const std::int32_t *>(array.children[1]->buffers[1]);
+    auto chars = static_cast<const char *>(array.children[1]->buffers[2]);
+    EXPECT_EQ(0, array.children[0]->null_count);
+    EXPECT_EQ(0, array.children[1]->null_count);
+
+    for (std::int32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(i, ids[i]);
+        EXPECT_EQ("s-" + std::to_string(i), std::string(chars + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+
+    array.release(&array);
+    schema.release(&schema);
+
+    EXPECT_EQ(nullptr, array.release);
+    EXPECT_EQ(nullptr, schema.release);
+    EXPECT_EQ(0, result_set.current_page().size());
+}
+
 TEST_F(sql_test, sql_select_multiple_pages) {
     sql_statement statement{"select id, val from TEST order by id"};
     statement.page_size(1);
@@ -176,6 +227,119 @@ TEST_F(sql_test, sql_select_multiple_pages) {
     EXPECT_EQ(0, result_set.current_page().size());
 }
 
+TEST_F(sql_test, sql_select_rows_multiple_pages) {
+    sql_statement statement{"select id, val from TEST order by id"};
+    statement.page_size(3);
+
+    auto result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+    std::int32_t i = 0;
+    for (const auto &row : result_set.rows()) {
+        EXPECT_EQ(i, row.get(0).get<std::int32_t>());
+        EXPECT_EQ("s-" + std::to_string(i), row.get_string_view(1));
+        ++i;
+    }
+
+    EXPECT_EQ(10, i);
+    EXPECT_FALSE(result_set.has_more_pages());
+    EXPECT_EQ(0, result_set.current_page().size());
+    EXPECT_EQ(result_set.rows().end(), result_set.rows().begin());
+}
+
+TEST_F(sql_test, sql_select_rows_after_current_page) {
+    sql_statement statement{"select id, val from TEST order by id"};
+    statement.page_size(4);
+
+    auto result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+    auto it = result_set.rows().begin();
+    ASSERT_NE(result_set.rows().end(), it);
+    EXPECT_EQ(0, it->get(0).get<std::int32_t>());
+
+    auto page = result_set.current_page();
+    ASSERT_EQ(3, page.size());
+    EXPECT_EQ(1, page.front().get(0).get<std::int32_t>());
+
+    std::int32_t i = 4;
+    for (++it; it != result_set.rows().end(); ++it, ++i)
+        EXPECT_EQ(i, (*it).get(0).get<std::int32_t>());
+
+    EXPECT_EQ(10, i);
+}
+
+TEST_F(sql_test, sql_select_multiple_pages_prefetch) {
+    for (std::size_t max_bytes : {std::size_t(1), sql_statement::DEFAULT_PREFETCH_MAX_BYTES}) {
+        sql_statement statement{"select id, val from TEST order by id"};
+        statement.page_size(1);
+        statement.prefetch_depth(3);
+        statement.prefetch_max_bytes(max_bytes);
+
+        auto result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+        for (std::int32_t i = 0; i < 10; ++i) {
+            auto page = result_set.current_page();
+
+            ASSERT_EQ(1, page.size()) << "i=" << i;
+            EXPECT_EQ(i, page.front().get(0).get<std::int32_t>());
+            EXPECT_EQ("s-" + std::to_string(i), page.front().get(1).get<std::string>());
+
+            if (i < 9) {
+                ASSERT_TRUE(result_set.has_more_pages());
+                result_set.fetch_next_page();
+            }
+        }
+
+        EXPECT_FALSE(result_set.has_more_pages());
+        EXPECT_EQ(0, result_set.current_page().size());
+    }
+}
+
+TEST_F(sql_test, sql_close_cursor_with_prefetch) {
+    sql_statement statement{"select id, val from TEST order by id"};
+    statement.page_size(2);
+    statement.prefetch_depth(2);
+
+    auto result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+    EXPECT_EQ(2, result_set.current_page().size());
+    ASSERT_TRUE(result_set.has_more_pages());
+
+    result_set.close();
+
+    EXPECT_FALSE(result_set.has_more_pages());
+    EXPECT_THROW(result_set.fetch_next_page(), ignite_error);
+}
+
+TEST_F(sql_test, sql_select_adaptive_page_size) {
+    sql_statement statement{"select id, val from TEST where id >= 0 order by id"};
+    statement.page_size(2);
+    statement.target_page_bytes(64 * 1024);
+
+    auto result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+    std::int32_t i = 0;
+    for (const auto &row : result_set.rows())
+        EXPECT_EQ(i++, row.get(0).get<std::int32_t>());
+
+    EXPECT_EQ(10, i);
+
+    auto stats = result_set.statistics();
+    EXPECT_EQ(2, stats.page_size);
+    EXPECT_EQ(5, stats.pages);
+    EXPECT_EQ(10, stats.rows);
+    EXPECT_GT(stats.bytes, 0);
+    EXPECT_GT(stats.average_row_size(), 0.0);
+
+    // The second execution uses the row size estimated from the first one, so all the rows fit in a single page.
+    result_set = m_client.get_sql().execute(nullptr, statement, {});
+
+    stats = result_set.statistics();
+    EXPECT_GT(stats.page_size, 10);
+    EXPECT_EQ(1, stats.pages);
+    EXPECT_EQ(10, result_set.current_page().size());
+    EXPECT_FALSE(result_set.has_more_pages());
+}
+
 TEST_F(sql_test, sql_close_non_empty_cursor) {
     sql_statement statement{"select id, val from TEST order by id"};
     statement.page_size(3);
@@ -340,6 +504,9 @@ TEST_F(sql_test, sql_statement_defaults) {
     EXPECT_EQ(statement.page_size(), sql_statement::DEFAULT_PAGE_SIZE);
     EXPECT_EQ(statement.schema(), sql_statement::DEFAULT_SCHEMA);
     EXPECT_EQ(statement.timeout(), sql_statement::DEFAULT_TIMEOUT);
+    EXPECT_EQ(statement.prefetch_depth(), sql_statement::DEFAULT_PREFETCH_DEPTH);
+    EXPECT_EQ(statement.prefetch_max_bytes(), sql_statement::DEFAULT_PREFETCH_MAX_BYTES);
+    EXPECT_EQ(statement.target_page_bytes(), sql_statement::DEFAULT_TARGET_PAGE_BYTES);
 }
 
 TEST_F(sql_test, decimal_literal) {
@@ -415,3 +582,84 @@ TEST_F(sql_test, uuid_argument) {
     auto value = result_set.current_page().front().get(0).get<uuid>();
     EXPECT_EQ(req, value);
 }
+
+TEST_F(sql_test, typed_arguments) {
+    using namespace std::string_view_literals;
+
+    auto result_set = m_client.get_sql().execute(
+        nullptr, {"select id, val from TEST where id > ? and val <> ? order by id"}, 6, "s-7"sv);
+
+    auto page = result_set.current_page();
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(8, page[0].get(0).get<std::int32_t>());
+    EXPECT_EQ(9, page[1].get(0).get<std::int32_t>());
+
+    uuid req{0x123e4567e89b12d3, 0x7456426614174000};
+    result_set = m_client.get_sql().execute(
+        nullptr, {"select MAX(UUID) from TBL_ALL_COLUMNS_SQL WHERE UUID = ? AND STR = ?"}, req, std::string("test"));
+
+    EXPECT_EQ(req, result_set.current_page().front().get(0).get<uuid>());
+}
+
+TEST_F(sql_test, typed_arguments_async) {
+    std::optional<std::int32_t> null_id;
+
+    auto result_set = sync<ignite::result_set>([&](auto callback) {
+        m_client.get_sql().execute_async(nullptr, {"select count(*) from TEST where id < ? or id = ?"},
+            std::forward_as_tuple(std::int64_t(3), null_id), std::move(callback));
+    });
+
+    EXPECT_EQ(3, result_set.current_page().front().get(0).get<std::int64_t>());
+}
+
+TEST_F(sql_test, result_cache_serves_repeated_query) {
+    sql_result_cache_options options;
+    options.ttl(std::chrono::seconds(60));
+    m_client.get_sql().enable_result_cache(options);
+
+    sql_statement query{"select val from TEST where id = ?"};
+    auto get_val = [&](std::int32_t id) {
+        return m_client.get_sql().execute(nullptr, query, {id}).current_page().front().get(0).get<std::string>();
+    };
+
+    EXPECT_EQ("s-1", get_val(1));
+    EXPECT_EQ("s-2", get_val(2));
+
+    // Changes made by another client are not tracked until the cache is invalidated.
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    auto other = ignite_client::start(cfg, std::chrono::seconds(30));
+    other.get_sql().execute(nullptr, {"UPDATE TEST SET val = 'changed' WHERE id = 1"}, {});
+
+    EXPECT_EQ("s-1", get_val(1));
+
+    m_client.get_sql().invalidate_result_cache();
+    EXPECT_EQ("changed", get_val(1));
+
+    // Statements without a row set drop all the cached results.
+    m_client.get_sql().execute(nullptr, {"UPDATE TEST SET val = 's-1' WHERE id = 1"}, {});
+    EXPECT_EQ("s-1", get_val(1));
+}
+
+TEST_F(sql_test, result_cache_is_invalidated_on_transaction_finish) {
+    m_client.get_sql().enable_result_cache({});
+
+    sql_statement query{"select val from TEST where id = ?"};
+    auto get_val = [&](std::int32_t id) {
+        return m_client.get_sql().execute(nullptr, query, {id}).current_page().front().get(0).get<std::string>();
+    };
+
+    EXPECT_EQ("s-3", get_val(3));
+
+    auto tx = m_client.get_transactions().begin();
+    m_client.get_sql().execute(&tx, {"UPDATE TEST SET val = 'changed' WHERE id = 3"}, {});
+
+    // Uncommitted changes are not visible, so the result cached before the commit is the old one.
+    EXPECT_EQ("s-3", get_val(3));
+
+    tx.commit();
+
+    EXPECT_EQ("changed", get_val(3));
+
+    m_client.get_sql().execute(nullptr, {"UPDATE TEST SET val = 's-3' WHERE id = 3"}, {});
+}
@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <thread>
 
 using namespace ignite;
 
@@ -115,6 +116,31 @@ TEST_F(transactions_test, destruction_does_not_update_data) {
     ASSERT_FALSE(actual.has_value());
 }
 
+TEST_F(transactions_test, operations_right_after_begin_are_visible_for_tx) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    auto tx = m_client.get_transactions().begin();
+
+    std::vector<ignite_tuple> records;
+    for (std::int64_t i = 0; i < 5; ++i)
+        records.emplace_back(get_tuple(i, "Lorem ipsum " + std::to_string(i)));
+
+    record_view.upsert_all(&tx, records);
+    auto in_tx = record_view.get(&tx, get_tuple(3));
+
+    tx.commit();
+
+    ASSERT_TRUE(in_tx.has_value());
+    EXPECT_EQ("Lorem ipsum 3", in_tx->get<std::string>("val"));
+
+    for (std::int64_t i = 0; i < 5; ++i) {
+        auto actual = record_view.get(nullptr, get_tuple(i));
+
+        ASSERT_TRUE(actual.has_value());
+        EXPECT_EQ("Lorem ipsum " + std::to_string(i), actual->get<std::string>("val"));
+    }
+}
+
 TEST_F(transactions_test, non_committed_data_visible_for_tx) {
     auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
 
@@ -429,3 +455,132 @@ TEST_F(transactions_test, record_view_remove_all_exact) {
     auto values2 = record_view.remove_all(nullptr, {value0});
     ASSERT_TRUE(values2.empty());
 }
+
+TEST_F(transactions_test, read_only_transaction_reads_committed_data) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    std::vector<ignite_tuple> records;
+    std::vector<ignite_tuple> keys;
+    for (std::int64_t i = 0; i < 10; ++i) {
+        records.emplace_back(get_tuple(i, "Lorem ipsum " + std::to_string(i)));
+        keys.emplace_back(get_tuple(i));
+    }
+    record_view.upsert_all(nullptr, records);
+
+    auto tx = m_client.get_transactions().begin(transaction_options{true});
+    auto values = record_view.get_all(&tx, keys);
+    tx.commit();
+
+    ASSERT_EQ(10, values.size());
+    for (std::int64_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(values[i].has_value());
+        EXPECT_EQ("Lorem ipsum " + std::to_string(i), values[i]->get<std::string>("val"));
+    }
+}
+
+TEST_F(transactions_test, read_only_transaction_does_not_allow_updates) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    auto tx = m_client.get_transactions().begin(transaction_options{true});
+
+    EXPECT_THROW(record_view.upsert(&tx, get_tuple(42, "Lorem ipsum")), ignite_error);
+}
+
+TEST_F(transactions_test, expired_transaction_is_rolled_back) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    auto tx = m_client.get_transactions().begin(transaction_options{false, std::chrono::milliseconds(200)});
+    record_view.upsert(&tx, get_tuple(42, "Lorem ipsum"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    EXPECT_THROW(
+        {
+            try {
+                record_view.upsert(&tx, get_tuple(43, "Lorem ipsum"));
+            } catch (const ignite_error &e) {
+                EXPECT_THAT(e.what_str(), testing::HasSubstr("Transaction timed out"));
+                throw;
+            }
+        },
+        ignite_error);
+
+    EXPECT_THROW(tx.commit(), ignite_error);
+
+    auto actual = record_view.get(nullptr, get_tuple(42));
+    ASSERT_FALSE(actual.has_value());
+}
+
+TEST_F(transactions_test, buffered_writes_are_visible_for_tx_and_committed) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    transaction_options options;
+    options.write_buffer_limit(100);
+
+    auto tx = m_client.get_transactions().begin(options);
+
+    for (std::int64_t i = 0; i < 50; ++i)
+        record_view.upsert(&tx, get_tuple(i % 10, "Lorem ipsum " + std::to_string(i)));
+
+    auto in_tx = record_view.get(&tx, get_tuple(3));
+
+    ASSERT_TRUE(in_tx.has_value());
+    EXPECT_EQ("Lorem ipsum 43", in_tx->get<std::string>("val"));
+
+    record_view.upsert(&tx, get_tuple(3, "Lorem ipsum"));
+    tx.commit();
+
+    for (std::int64_t i = 0; i < 10; ++i) {
+        auto actual = record_view.get(nullptr, get_tuple(i));
+
+        ASSERT_TRUE(actual.has_value());
+        auto expected = i == 3 ? std::string("Lorem ipsum") : "Lorem ipsum " + std::to_string(40 + i);
+        EXPECT_EQ(expected, actual->get<std::string>("val"));
+    }
+}
+
+TEST_F(transactions_test, buffered_writes_are_discarded_on_rollback) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    transaction_options options;
+    options.write_buffer_limit(3);
+
+    auto tx = m_client.get_transactions().begin(options);
+
+    // Exceeds the limit, so some of the writes are sent before the rollback.
+    for (std::int64_t i = 0; i < 5; ++i)
+        record_view.upsert(&tx, get_tuple(i, "Lorem ipsum"));
+
+    tx.rollback();
+
+    for (std::int64_t i = 0; i < 5; ++i) {
+        auto actual = record_view.get(nullptr, get_tuple(i));
+
+        EXPECT_FALSE(actual.has_value());
+    }
+}
+
+TEST_F(transactions_test, failed_buffered_writes_roll_back_on_commit) {
+    auto record_view = m_client.get_tables().get_table("tbl1")->get_record_binary_view();
+
+    auto tx1 = m_client.get_transactions().begin();
+    record_view.upsert(&tx1, get_tuple(1, "Lorem ipsum"));
+
+    transaction_options options;
+    options.write_buffer_limit(1);
+
+    // Every write is flushed right away, and the second one conflicts with the older transaction.
+    auto tx2 = m_client.get_transactions().begin(options);
+    record_view.upsert(&tx2, get_tuple(2, "Lorem ipsum"));
+    record_view.upsert(&tx2, get_tuple(1, "Lorem ipsum"));
+
+    EXPECT_THROW(tx2.commit(), ignite_error);
+    tx1.rollback();
+
+    // The failed transaction is rolled back, so the record written by it is not locked anymore.
+    record_view.upsert(nullptr, get_tuple(2, "Dolor sit amet"));
+
+    auto actual = record_view.get(nullptr, get_tuple(2));
+    ASSERT_TRUE(actual.has_value());
+    EXPECT_EQ("Dolor sit amet", actual->get<std::string>("val"));
+}